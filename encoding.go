@@ -2,6 +2,7 @@ package kyber
 
 import (
 	"encoding"
+	"errors"
 	"io"
 )
 
@@ -31,6 +32,47 @@ type Marshaling interface {
 	UnmarshalFrom(r io.Reader) (int, error)
 }
 
+// BinaryAppender is an optional interface for Marshaling objects that can
+// append their binary encoding to a caller-provided buffer, so that encoding
+// them does not have to allocate.
+type BinaryAppender interface {
+	// AppendBinary appends the binary encoding of the object to buf and
+	// returns the extended buffer. It only allocates if buf does not have
+	// the capacity for MarshalSize() more bytes.
+	AppendBinary(buf []byte) ([]byte, error)
+}
+
+// AppendBinary appends the binary encoding of m to buf and returns the
+// extended buffer, using m's own AppendBinary method if it implements
+// BinaryAppender and MarshalBinary otherwise.
+func AppendBinary(buf []byte, m Marshaling) ([]byte, error) {
+	if a, ok := m.(BinaryAppender); ok {
+		return a.AppendBinary(buf)
+	}
+	b, err := m.MarshalBinary()
+	if err != nil {
+		return buf, err
+	}
+	return append(buf, b...), nil
+}
+
+// MarshalInto writes the binary encoding of m to the start of buf, which must
+// be at least m.MarshalSize() bytes long, and returns the number of bytes
+// written.
+func MarshalInto(buf []byte, m Marshaling) (int, error) {
+	if len(buf) < m.MarshalSize() {
+		return 0, errors.New("buffer too small for the encoding")
+	}
+	b, err := AppendBinary(buf[:0], m)
+	if err != nil {
+		return 0, err
+	}
+	if len(b) > len(buf) {
+		return 0, errors.New("encoding longer than MarshalSize")
+	}
+	return len(b), nil
+}
+
 // Encoding represents an abstract interface to an encoding/decoding that can be
 // used to marshal/unmarshal objects to and from streams. Different Encodings
 // will have different constraints, of course. Two implementations are
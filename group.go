@@ -2,6 +2,7 @@ package kyber
 
 import (
 	"crypto/cipher"
+	"errors"
 )
 
 // Scalar represents a scalar value by which
@@ -124,6 +125,114 @@ type AllowsVarTime interface {
 	AllowVarTime(bool)
 }
 
+// Precomputable is an optional interface for Points that can precompute a
+// table of multiples of their current value, so that later multiplications
+// of that value by Scalars, i.e. calls to Mul(s, p), run faster. Building the
+// table costs a few multiplications and some memory, which pays off for
+// long-lived Points such as a secondary generator or a long-term public key.
+// The table no longer applies once the Point is set to another value.
+type Precomputable interface {
+	Precompute()
+}
+
+// MultiScalarMul is an optional interface that the Points of a Group can
+// implement to compute linear combinations of Points,
+//   scalars[0]*points[0] + scalars[1]*points[1] + ... + scalars[n-1]*points[n-1],
+// faster than with a sequence of Mul and Add, e.g. by sharing the point
+// doublings between all the terms. A nil entry in points stands for the
+// standard base point, as in Point.Mul. Implementations may use variable
+// time algorithms, thus MultiScalarMul must only be used on public Scalars
+// and Points. Generic code should call LinearCombination, which falls back
+// to Mul and Add for Groups without a dedicated implementation.
+type MultiScalarMul interface {
+	// MultiScalarMul sets the receiver to the linear combination of points
+	// with coefficients scalars, and returns it.
+	// It panics if the two slices have different lengths.
+	MultiScalarMul(scalars []Scalar, points []Point) Point
+}
+
+// LinearCombination returns a new Point of Group g set to
+//   scalars[0]*points[0] + scalars[1]*points[1] + ... + scalars[n-1]*points[n-1].
+// It uses the MultiScalarMul implementation of the Group's Points if there
+// is one, and a sequence of Mul and Add otherwise. As MultiScalarMul may run
+// in variable time, it must only be used on public Scalars and Points.
+func LinearCombination(g Group, scalars []Scalar, points []Point) Point {
+	if len(scalars) != len(points) {
+		panic("kyber: mismatched number of scalars and points")
+	}
+	sum := g.Point()
+	if msm, ok := sum.(MultiScalarMul); ok {
+		return msm.MultiScalarMul(scalars, points)
+	}
+	sum.Null()
+	term := g.Point()
+	for i := range scalars {
+		sum.Add(sum, term.Mul(scalars[i], points[i]))
+	}
+	return sum
+}
+
+// BatchInv sets every Scalar of scalars to its inverse. It uses Montgomery's
+// simultaneous inversion trick, which replaces all but one Inv by three Mul
+// each and runs in constant time if Mul and Inv do. The Scalars must be
+// invertible, distinct objects and belong to the same Group.
+func BatchInv(scalars []Scalar) {
+	if len(scalars) == 0 {
+		return
+	}
+
+	// acc[i] = scalars[0]*scalars[1]*...*scalars[i]
+	acc := make([]Scalar, len(scalars))
+	acc[0] = scalars[0].Clone()
+	for i := 1; i < len(scalars); i++ {
+		acc[i] = scalars[i].Clone().Mul(acc[i-1], scalars[i])
+	}
+
+	last := len(scalars) - 1
+	inv := acc[last].Inv(acc[last])
+	tmp := scalars[0].Clone()
+	for i := last; i > 0; i-- {
+		tmp.Mul(inv, acc[i-1])   // 1/scalars[i]
+		inv.Mul(inv, scalars[i]) // 1/(scalars[0]*...*scalars[i-1])
+		scalars[i].Set(tmp)
+	}
+	scalars[0].Set(inv)
+}
+
+// BatchMarshaling is an optional interface that a Group can implement to
+// encode many of its Points at once faster than one by one, e.g. by sharing
+// a single field inversion between all of them. Generic code should call
+// MarshalPoints, which falls back to MarshalBinary for other Groups.
+type BatchMarshaling interface {
+	// MarshalPoints writes the encodings of points one after the other
+	// into buf, which must be exactly len(points)*PointLen() bytes long.
+	MarshalPoints(buf []byte, points []Point) error
+}
+
+// MarshalPoints writes the encodings of points, which must all belong to
+// Group g, one after the other into buf. The length of buf must be exactly
+// len(points)*g.PointLen(), and every Point must encode to g.PointLen() bytes.
+func MarshalPoints(g Group, buf []byte, points []Point) error {
+	if bm, ok := g.(BatchMarshaling); ok {
+		return bm.MarshalPoints(buf, points)
+	}
+	pl := g.PointLen()
+	if len(buf) != len(points)*pl {
+		return errors.New("kyber: wrong size buffer")
+	}
+	for i, p := range points {
+		b, err := p.MarshalBinary()
+		if err != nil {
+			return err
+		}
+		if len(b) != pl {
+			return errors.New("kyber: point encoding of unexpected length")
+		}
+		copy(buf[i*pl:], b)
+	}
+	return nil
+}
+
 // Group interface represents a mathematical group
 // usable for Diffie-Hellman key exchange, ElGamal encryption,
 // and the related body of public-key cryptographic algorithms
@@ -3,6 +3,10 @@ package edwards25519
 import (
 	"crypto/cipher"
 	"crypto/sha512"
+	"errors"
+	"fmt"
+	"runtime"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/util/random"
@@ -45,6 +49,93 @@ func (c *Curve) Point() kyber.Point {
 	return P
 }
 
+// MarshalPoints writes the 32-byte encodings of points one after the other
+// into buf, which must be exactly 32*len(points) bytes long. It shares a
+// single field inversion between all the points, which makes it much faster
+// than calling MarshalBinary on each of them for long vectors of points.
+func (c *Curve) MarshalPoints(buf []byte, points []kyber.Point) error {
+	if len(buf) != 32*len(points) {
+		return errors.New("wrong size buffer")
+	}
+	ge := make([]*extendedGroupElement, len(points))
+	for i, p := range points {
+		ge[i] = &p.(*point).ge
+	}
+	geBatchToBytes(buf, ge)
+	return nil
+}
+
+// unmarshalShardSize is the least number of points that UnmarshalPoints
+// hands over to a goroutine of its own.
+const unmarshalShardSize = 128
+
+// PointsError is returned by UnmarshalPoints when some of the encodings
+// are not valid points. Invalid lists their indices in increasing order.
+type PointsError struct {
+	Invalid []int
+}
+
+func (e *PointsError) Error() string {
+	return fmt.Sprintf("invalid Ed25519 curve points at indices %v", e.Invalid)
+}
+
+// UnmarshalPoints decodes the 32-byte encodings packed one after the other
+// in buf into points, which must be exactly 32*len(points) bytes long.
+// Nil entries of points are filled in with new Points. Large batches are
+// split between several goroutines. An invalid encoding does not stop the
+// decoding of the others: it leaves its entry of points unchanged, and the
+// returned error is then a *PointsError listing all such indices.
+func (c *Curve) UnmarshalPoints(points []kyber.Point, buf []byte) error {
+	if len(buf) != 32*len(points) {
+		return errors.New("wrong size buffer")
+	}
+	for i := range points {
+		if points[i] == nil {
+			points[i] = c.Point()
+		}
+	}
+
+	valid := make([]bool, len(points))
+	decode := func(lo, hi int) {
+		var ge extendedGroupElement
+		for i := lo; i < hi; i++ {
+			if ge.FromBytes(buf[32*i : 32*(i+1)]) {
+				points[i].(*point).ge = ge
+				valid[i] = true
+			}
+		}
+	}
+
+	shards := runtime.GOMAXPROCS(0)
+	if max := len(points) / unmarshalShardSize; shards > max {
+		shards = max
+	}
+	if shards <= 1 {
+		decode(0, len(points))
+	} else {
+		var wg sync.WaitGroup
+		wg.Add(shards)
+		for k := 0; k < shards; k++ {
+			go func(lo, hi int) {
+				decode(lo, hi)
+				wg.Done()
+			}(k*len(points)/shards, (k+1)*len(points)/shards)
+		}
+		wg.Wait()
+	}
+
+	var invalid []int
+	for i, ok := range valid {
+		if !ok {
+			invalid = append(invalid, i)
+		}
+	}
+	if invalid != nil {
+		return &PointsError{invalid}
+	}
+	return nil
+}
+
 // NewKeyAndSeedWithInput returns a formatted Ed25519 key (avoid subgroup attack by
 // requiring it to be a multiple of 8). It also returns the input and the digest used
 // to generate the key.
@@ -5,6 +5,8 @@ import (
 	"testing"
 
 	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/util/test"
 )
 
@@ -26,6 +28,62 @@ func TestCurve_NewKey(t *testing.T) {
 	}
 }
 
+func TestCurve_UnmarshalPoints(t *testing.T) {
+	group := Curve{}
+	stream := tSuite.RandomStream()
+
+	// An encoding of a y coordinate with no matching x
+	var bad [32]byte
+	for bad[0] = 2; group.Point().UnmarshalBinary(bad[:]) == nil; bad[0]++ {
+	}
+
+	for _, n := range []int{0, 1, 5, 1000} {
+		points := make([]kyber.Point, n)
+		for i := range points {
+			points[i] = group.Point().Pick(stream)
+		}
+		buf := make([]byte, 32*n)
+		require.NoError(t, group.MarshalPoints(buf, points))
+
+		var invalid []int
+		for i := 3; i < n; i += 400 {
+			copy(buf[32*i:], bad[:])
+			invalid = append(invalid, i)
+		}
+
+		decoded := make([]kyber.Point, n)
+		err := group.UnmarshalPoints(decoded, buf)
+		if invalid == nil {
+			require.NoError(t, err, "n = %d", n)
+		} else {
+			require.Equal(t, &PointsError{invalid}, err, "n = %d", n)
+		}
+		for i := range points {
+			if len(invalid) > 0 && invalid[0] == i {
+				invalid = invalid[1:]
+				continue
+			}
+			require.True(t, decoded[i].Equal(points[i]), "n = %d, i = %d", n, i)
+		}
+	}
+
+	require.Error(t, group.UnmarshalPoints(make([]kyber.Point, 2), make([]byte, 63)))
+}
+
+func BenchmarkCurveUnmarshalPoints(b *testing.B) {
+	group := Curve{}
+	points := make([]kyber.Point, 1000)
+	for i := range points {
+		points[i] = group.Point().Pick(tSuite.RandomStream())
+	}
+	buf := make([]byte, 32*len(points))
+	_ = group.MarshalPoints(buf, points)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = group.UnmarshalPoints(points, buf)
+	}
+}
+
 func BenchmarkScalarAdd(b *testing.B)    { groupBench.ScalarAdd(b.N) }
 func BenchmarkScalarSub(b *testing.B)    { groupBench.ScalarSub(b.N) }
 func BenchmarkScalarNeg(b *testing.B)    { groupBench.ScalarNeg(b.N) }
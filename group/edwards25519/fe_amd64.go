@@ -0,0 +1,55 @@
+// +build amd64,!generic
+
+package edwards25519
+
+import (
+	"golang.org/x/sys/cpu"
+)
+
+var hasAVX2 = cpu.X86.HasAVX2
+
+//go:noescape
+func feMul4AVX2(h0, h1, h2, h3, f0, f1, f2, f3, g0, g1, g2, g3 *fieldElement)
+
+// The point formulas in ge.go compute three or four independent products at
+// a time. Where AVX2 is available, feMul4, feMul3 and feDoublingSquares
+// compute them in parallel in the four lanes of feMul4AVX2. In all of them,
+// an output can overlap the inputs of the same or an earlier product.
+
+// feMul4 calculates h0 = f0 * g0, h1 = f1 * g1, h2 = f2 * g2 and h3 = f3 * g3.
+func feMul4(h0, h1, h2, h3, f0, f1, f2, f3, g0, g1, g2, g3 *fieldElement) {
+	if hasAVX2 {
+		feMul4AVX2(h0, h1, h2, h3, f0, f1, f2, f3, g0, g1, g2, g3)
+		return
+	}
+	feMul(h0, f0, g0)
+	feMul(h1, f1, g1)
+	feMul(h2, f2, g2)
+	feMul(h3, f3, g3)
+}
+
+// feMul3 calculates h0 = f0 * g0, h1 = f1 * g1 and h2 = f2 * g2.
+func feMul3(h0, h1, h2, f0, f1, f2, g0, g1, g2 *fieldElement) {
+	if hasAVX2 {
+		feMul4AVX2(h0, h1, h2, h2, f0, f1, f2, f2, g0, g1, g2, g2)
+		return
+	}
+	feMul(h0, f0, g0)
+	feMul(h1, f1, g1)
+	feMul(h2, f2, g2)
+}
+
+// feDoublingSquares calculates the squares of point doubling,
+// h0 = f0^2, h1 = f1^2, h2 = 2 * f2^2 and h3 = f3^2.
+func feDoublingSquares(h0, h1, h2, h3, f0, f1, f2, f3 *fieldElement) {
+	if hasAVX2 {
+		var f2x2 fieldElement
+		feAdd(&f2x2, f2, f2)
+		feMul4AVX2(h0, h1, h2, h3, f0, f1, f2, f3, f0, f1, &f2x2, f3)
+		return
+	}
+	feSquare(h0, f0)
+	feSquare(h1, f1)
+	feSquare2(h2, f2)
+	feSquare(h3, f3)
+}
@@ -0,0 +1,392 @@
+// +build amd64,!generic
+
+#include "textflag.h"
+
+// feMul4AVX2 computes four independent field multiplications at once, one in
+// each 64-bit lane of the AVX2 registers. The radix 2^51 limbs of the inputs
+// are transposed into lanes and split into ten limbs in radix 2^25.5, whose
+// products fit in the 32x32-bit multiplications of VPMULUDQ, as in ref10.
+// The results are carried and joined back into radix 2^51.
+
+DATA mask26<>+0(SB)/8, $0x3ffffff
+DATA mask26<>+8(SB)/8, $0x3ffffff
+DATA mask26<>+16(SB)/8, $0x3ffffff
+DATA mask26<>+24(SB)/8, $0x3ffffff
+GLOBL mask26<>(SB), RODATA|NOPTR, $32
+
+DATA mask25<>+0(SB)/8, $0x1ffffff
+DATA mask25<>+8(SB)/8, $0x1ffffff
+DATA mask25<>+16(SB)/8, $0x1ffffff
+DATA mask25<>+24(SB)/8, $0x1ffffff
+GLOBL mask25<>(SB), RODATA|NOPTR, $32
+
+DATA c19<>+0(SB)/8, $19
+DATA c19<>+8(SB)/8, $19
+DATA c19<>+16(SB)/8, $19
+DATA c19<>+24(SB)/8, $19
+GLOBL c19<>(SB), RODATA|NOPTR, $32
+
+// Stack frame offsets of the limbs in radix 2^25.5: f[i] at F+32*i,
+// g[i] at G+32*i and 19*g[i] at G19+32*i.
+#define F 0
+#define G 320
+#define G19 640
+
+// transposeLoad loads the radix 2^51 limbs 0-3 of the field elements at
+// a, b, c and d into l0-l3, lane by lane, and their limb 4 into l4.
+#define transposeLoad(a, b, c, d, l0, l1, l2, l3, l4, t0, t1, t2, t3) \
+	VMOVDQU (a), l0 \
+	VMOVDQU (b), l1 \
+	VMOVDQU (c), l2 \
+	VMOVDQU (d), l3 \
+	VPUNPCKLQDQ l1, l0, t0 \
+	VPUNPCKHQDQ l1, l0, t1 \
+	VPUNPCKLQDQ l3, l2, t2 \
+	VPUNPCKHQDQ l3, l2, t3 \
+	VPERM2I128 $0x20, t2, t0, l0 \
+	VPERM2I128 $0x20, t3, t1, l1 \
+	VPERM2I128 $0x31, t2, t0, l2 \
+	VPERM2I128 $0x31, t3, t1, l3 \
+	VMOVQ 32(a), X14 \
+	VPINSRQ $1, 32(b), X14, X14 \
+	VMOVQ 32(c), X15 \
+	VPINSRQ $1, 32(d), X15, X15 \
+	VINSERTI128 $1, X15, Y14, l4
+
+// split stores the radix 2^51 limb l as the two radix 2^25.5 limbs
+// at off and off+32, clobbering l.
+#define split(l, off) \
+	VPAND mask26<>(SB), l, Y15 \
+	VMOVDQU Y15, off(SP) \
+	VPSRLQ $26, l, l \
+	VMOVDQU l, off+32(SP)
+
+// carry propagates the bits of a above its shift lowest into b.
+#define carry(a, b, shift, mask) \
+	VPSRLQ $shift, a, Y12 \
+	VPADDQ Y12, b, b \
+	VPAND mask, a, a
+
+// func feMul4AVX2(h0, h1, h2, h3, f0, f1, f2, f3, g0, g1, g2, g3 *fieldElement)
+TEXT ·feMul4AVX2(SB), 0, $960-96
+	MOVQ f0+32(FP), AX
+	MOVQ f1+40(FP), BX
+	MOVQ f2+48(FP), CX
+	MOVQ f3+56(FP), DX
+	transposeLoad(AX, BX, CX, DX, Y0, Y1, Y2, Y3, Y4, Y8, Y9, Y10, Y11)
+	split(Y0, F+0)
+	split(Y1, F+64)
+	split(Y2, F+128)
+	split(Y3, F+192)
+	split(Y4, F+256)
+
+	MOVQ g0+64(FP), AX
+	MOVQ g1+72(FP), BX
+	MOVQ g2+80(FP), CX
+	MOVQ g3+88(FP), DX
+	transposeLoad(AX, BX, CX, DX, Y0, Y1, Y2, Y3, Y4, Y8, Y9, Y10, Y11)
+	split(Y0, G+0)
+	split(Y1, G+64)
+	split(Y2, G+128)
+	split(Y3, G+192)
+	split(Y4, G+256)
+
+	// 19*g[j] for j >= 1, the coefficients of the products that wrap
+	// around 2^255 = 19
+	VMOVDQU c19<>(SB), Y13
+	VPMULUDQ G+32(SP), Y13, Y12
+	VMOVDQU Y12, G19+32(SP)
+	VPMULUDQ G+64(SP), Y13, Y12
+	VMOVDQU Y12, G19+64(SP)
+	VPMULUDQ G+96(SP), Y13, Y12
+	VMOVDQU Y12, G19+96(SP)
+	VPMULUDQ G+128(SP), Y13, Y12
+	VMOVDQU Y12, G19+128(SP)
+	VPMULUDQ G+160(SP), Y13, Y12
+	VMOVDQU Y12, G19+160(SP)
+	VPMULUDQ G+192(SP), Y13, Y12
+	VMOVDQU Y12, G19+192(SP)
+	VPMULUDQ G+224(SP), Y13, Y12
+	VMOVDQU Y12, G19+224(SP)
+	VPMULUDQ G+256(SP), Y13, Y12
+	VMOVDQU Y12, G19+256(SP)
+	VPMULUDQ G+288(SP), Y13, Y12
+	VMOVDQU Y12, G19+288(SP)
+
+	// h[k] = sum of f[i]*g[j] for i+j = k mod 10, times 19 if i+j >= 10,
+	// and times 2 if both i and j are odd, accumulated in Y0-Y9.
+
+	VMOVDQU F+0(SP), Y10
+	VPMULUDQ G+0(SP), Y10, Y0
+	VPMULUDQ G+32(SP), Y10, Y1
+	VPMULUDQ G+64(SP), Y10, Y2
+	VPMULUDQ G+96(SP), Y10, Y3
+	VPMULUDQ G+128(SP), Y10, Y4
+	VPMULUDQ G+160(SP), Y10, Y5
+	VPMULUDQ G+192(SP), Y10, Y6
+	VPMULUDQ G+224(SP), Y10, Y7
+	VPMULUDQ G+256(SP), Y10, Y8
+	VPMULUDQ G+288(SP), Y10, Y9
+
+	VMOVDQU F+32(SP), Y10
+	VPADDQ Y10, Y10, Y11
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G+32(SP), Y11, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G+96(SP), Y11, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G+128(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G+160(SP), Y11, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+192(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+224(SP), Y11, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+256(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+288(SP), Y11, Y12
+	VPADDQ Y12, Y0, Y0
+
+	VMOVDQU F+64(SP), Y10
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G+32(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G+96(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G+128(SP), Y10, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+160(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+192(SP), Y10, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+224(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+288(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+
+	VMOVDQU F+96(SP), Y10
+	VPADDQ Y10, Y10, Y11
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G+32(SP), Y11, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G+96(SP), Y11, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+128(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+160(SP), Y11, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+192(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+224(SP), Y11, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+288(SP), Y11, Y12
+	VPADDQ Y12, Y2, Y2
+
+	VMOVDQU F+128(SP), Y10
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G+32(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+96(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+128(SP), Y10, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+160(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+224(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+288(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+
+	VMOVDQU F+160(SP), Y10
+	VPADDQ Y10, Y10, Y11
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G+32(SP), Y11, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+96(SP), Y11, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+128(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+160(SP), Y11, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+224(SP), Y11, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G19+288(SP), Y11, Y12
+	VPADDQ Y12, Y4, Y4
+
+	VMOVDQU F+192(SP), Y10
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G+32(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+96(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+128(SP), Y10, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+160(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+224(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G19+288(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+
+	VMOVDQU F+224(SP), Y10
+	VPADDQ Y10, Y10, Y11
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G+32(SP), Y11, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+64(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+96(SP), Y11, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+128(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+160(SP), Y11, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G19+224(SP), Y11, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G19+288(SP), Y11, Y12
+	VPADDQ Y12, Y6, Y6
+
+	VMOVDQU F+256(SP), Y10
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y8, Y8
+	VPMULUDQ G+32(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+64(SP), Y10, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+96(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+128(SP), Y10, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+160(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G19+224(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G19+288(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+
+	VMOVDQU F+288(SP), Y10
+	VPADDQ Y10, Y10, Y11
+	VPMULUDQ G+0(SP), Y10, Y12
+	VPADDQ Y12, Y9, Y9
+	VPMULUDQ G19+32(SP), Y11, Y12
+	VPADDQ Y12, Y0, Y0
+	VPMULUDQ G19+64(SP), Y10, Y12
+	VPADDQ Y12, Y1, Y1
+	VPMULUDQ G19+96(SP), Y11, Y12
+	VPADDQ Y12, Y2, Y2
+	VPMULUDQ G19+128(SP), Y10, Y12
+	VPADDQ Y12, Y3, Y3
+	VPMULUDQ G19+160(SP), Y11, Y12
+	VPADDQ Y12, Y4, Y4
+	VPMULUDQ G19+192(SP), Y10, Y12
+	VPADDQ Y12, Y5, Y5
+	VPMULUDQ G19+224(SP), Y11, Y12
+	VPADDQ Y12, Y6, Y6
+	VPMULUDQ G19+256(SP), Y10, Y12
+	VPADDQ Y12, Y7, Y7
+	VPMULUDQ G19+288(SP), Y11, Y12
+	VPADDQ Y12, Y8, Y8
+
+	// Carry h, folding the carry out of h[9] back into h[0] times 19,
+	// until every h[i] fits in its 26 or 25 bits again
+	VMOVDQU mask26<>(SB), Y13
+	VMOVDQU mask25<>(SB), Y14
+	carry(Y0, Y1, 26, Y13)
+	carry(Y1, Y2, 25, Y14)
+	carry(Y2, Y3, 26, Y13)
+	carry(Y3, Y4, 25, Y14)
+	carry(Y4, Y5, 26, Y13)
+	carry(Y5, Y6, 25, Y14)
+	carry(Y6, Y7, 26, Y13)
+	carry(Y7, Y8, 25, Y14)
+	carry(Y8, Y9, 26, Y13)
+	VPSRLQ $25, Y9, Y12
+	VPAND Y14, Y9, Y9
+	VPSLLQ $4, Y12, Y11
+	VPADDQ Y12, Y11, Y11
+	VPADDQ Y12, Y12, Y12
+	VPADDQ Y12, Y11, Y11
+	VPADDQ Y11, Y0, Y0
+	carry(Y0, Y1, 26, Y13)
+	carry(Y1, Y2, 25, Y14)
+
+	// Join the limbs back into radix 2^51 and transpose them to h0-h3
+	VPSLLQ $26, Y1, Y1
+	VPADDQ Y1, Y0, Y0
+	VPSLLQ $26, Y3, Y3
+	VPADDQ Y3, Y2, Y2
+	VPSLLQ $26, Y5, Y5
+	VPADDQ Y5, Y4, Y4
+	VPSLLQ $26, Y7, Y7
+	VPADDQ Y7, Y6, Y6
+	VPSLLQ $26, Y9, Y9
+	VPADDQ Y9, Y8, Y8
+	VPUNPCKLQDQ Y2, Y0, Y10
+	VPUNPCKHQDQ Y2, Y0, Y11
+	VPUNPCKLQDQ Y6, Y4, Y12
+	VPUNPCKHQDQ Y6, Y4, Y13
+	VPERM2I128 $0x20, Y12, Y10, Y1
+	VPERM2I128 $0x20, Y13, Y11, Y3
+	VPERM2I128 $0x31, Y12, Y10, Y5
+	VPERM2I128 $0x31, Y13, Y11, Y7
+	VEXTRACTI128 $1, Y8, X9
+
+	MOVQ h0+0(FP), AX
+	MOVQ h1+8(FP), BX
+	MOVQ h2+16(FP), CX
+	MOVQ h3+24(FP), DX
+	VMOVDQU Y1, (AX)
+	VMOVDQU Y3, (BX)
+	VMOVDQU Y5, (CX)
+	VMOVDQU Y7, (DX)
+	VMOVQ X8, 32(AX)
+	VPEXTRQ $1, X8, 32(BX)
+	VMOVQ X9, 32(CX)
+	VPEXTRQ $1, X9, 32(DX)
+
+	VZEROUPPER
+	RET
@@ -0,0 +1,30 @@
+// +build !amd64 generic
+
+package edwards25519
+
+// feMul4 calculates h0 = f0 * g0, h1 = f1 * g1, h2 = f2 * g2 and h3 = f3 * g3.
+// Can overlap an output with the inputs of the same or an earlier product.
+func feMul4(h0, h1, h2, h3, f0, f1, f2, f3, g0, g1, g2, g3 *fieldElement) {
+	feMul(h0, f0, g0)
+	feMul(h1, f1, g1)
+	feMul(h2, f2, g2)
+	feMul(h3, f3, g3)
+}
+
+// feMul3 calculates h0 = f0 * g0, h1 = f1 * g1 and h2 = f2 * g2.
+// Can overlap an output with the inputs of the same or an earlier product.
+func feMul3(h0, h1, h2, f0, f1, f2, g0, g1, g2 *fieldElement) {
+	feMul(h0, f0, g0)
+	feMul(h1, f1, g1)
+	feMul(h2, f2, g2)
+}
+
+// feDoublingSquares calculates the squares of point doubling,
+// h0 = f0^2, h1 = f1^2, h2 = 2 * f2^2 and h3 = f3^2.
+// Can overlap an output with the inputs of the same or an earlier square.
+func feDoublingSquares(h0, h1, h2, h3, f0, f1, f2, f3 *fieldElement) {
+	feSquare(h0, f0)
+	feSquare(h1, f1)
+	feSquare2(h2, f2)
+	feSquare(h3, f3)
+}
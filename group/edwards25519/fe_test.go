@@ -0,0 +1,137 @@
+package edwards25519
+
+import (
+	"math/big"
+	"math/rand"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// feBig returns the integer encoded in little-endian by b.
+func feBig(b []byte) *big.Int {
+	be := make([]byte, len(b))
+	for i := range b {
+		be[len(b)-1-i] = b[i]
+	}
+	return new(big.Int).SetBytes(be)
+}
+
+// feTestValues returns little-endian encodings of random field elements,
+// along with values near 0, p and 2^255.
+func feTestValues() [][]byte {
+	var vals [][]byte
+	for _, v := range []*big.Int{
+		big.NewInt(0),
+		big.NewInt(1),
+		new(big.Int).Sub(prime, big.NewInt(1)),
+		new(big.Int).Set(prime),
+		new(big.Int).Add(prime, big.NewInt(1)),
+		new(big.Int).Sub(new(big.Int).Lsh(big.NewInt(1), 255), big.NewInt(1)),
+	} {
+		b := make([]byte, 32)
+		for i, x := range v.Bytes() {
+			b[len(v.Bytes())-1-i] = x
+		}
+		vals = append(vals, b)
+	}
+	rnd := rand.New(rand.NewSource(1))
+	for i := 0; i < 100; i++ {
+		b := make([]byte, 32)
+		rnd.Read(b)
+		b[31] &= 0x7f
+		vals = append(vals, b)
+	}
+	return vals
+}
+
+func TestFieldElement(t *testing.T) {
+	vals := feTestValues()
+	for i := range vals {
+		a := vals[i]
+		b := vals[(i+1)%len(vals)]
+		var fa, fb, h fieldElement
+		feFromBytes(&fa, a)
+		feFromBytes(&fb, b)
+		ba := feBig(a)
+		bb := feBig(b)
+
+		check := func(op string, h *fieldElement, want *big.Int) {
+			var s [32]byte
+			feToBytes(&s, h)
+			want.Mod(want, prime)
+			require.Equal(t, want.String(), feBig(s[:]).String(), "%s of %x and %x", op, a, b)
+		}
+
+		feAdd(&h, &fa, &fb)
+		check("add", &h, new(big.Int).Add(ba, bb))
+		feSub(&h, &fa, &fb)
+		check("sub", &h, new(big.Int).Sub(ba, bb))
+		feNeg(&h, &fa)
+		check("neg", &h, new(big.Int).Neg(ba))
+		feMul(&h, &fa, &fb)
+		check("mul", &h, new(big.Int).Mul(ba, bb))
+		feSquare(&h, &fa)
+		check("square", &h, new(big.Int).Mul(ba, ba))
+		feSquare2(&h, &fa)
+		check("square2", &h, new(big.Int).Lsh(new(big.Int).Mul(ba, ba), 1))
+		if ba.Cmp(big.NewInt(0)) != 0 && ba.Cmp(prime) != 0 {
+			feInvert(&h, &fa)
+			check("invert", &h, new(big.Int).ModInverse(ba, prime))
+		}
+	}
+}
+
+func BenchmarkFeMul(b *testing.B) {
+	var x fieldElement
+	feCopy(&x, &d)
+	for i := 0; i < b.N; i++ {
+		feMul(&x, &x, &d)
+	}
+}
+
+func BenchmarkFeSquare(b *testing.B) {
+	var x fieldElement
+	feCopy(&x, &d)
+	for i := 0; i < b.N; i++ {
+		feSquare(&x, &x)
+	}
+}
+
+func BenchmarkFeInvert(b *testing.B) {
+	var x fieldElement
+	feCopy(&x, &d)
+	for i := 0; i < b.N; i++ {
+		feInvert(&x, &x)
+	}
+}
+
+func TestFeMul4(t *testing.T) {
+	vals := feTestValues()
+	var f, g, h [4]fieldElement
+	for i := 0; i+4 <= len(vals); i += 4 {
+		for j := range f {
+			feFromBytes(&f[j], vals[i+j])
+			feFromBytes(&g[j], vals[(i+j+5)%len(vals)])
+		}
+		feMul4(&h[0], &h[1], &h[2], &h[3], &f[0], &f[1], &f[2], &f[3], &g[0], &g[1], &g[2], &g[3])
+		for j := range h {
+			var want fieldElement
+			var s1, s2 [32]byte
+			feMul(&want, &f[j], &g[j])
+			feToBytes(&s1, &h[j])
+			feToBytes(&s2, &want)
+			require.Equal(t, s2, s1, "lane %d of %x and %x", j, vals[i+j], vals[(i+j+5)%len(vals)])
+		}
+	}
+}
+
+func BenchmarkFeMul4(b *testing.B) {
+	var x [4]fieldElement
+	for j := range x {
+		feCopy(&x[j], &d)
+	}
+	for i := 0; i < b.N; i++ {
+		feMul4(&x[0], &x[1], &x[2], &x[3], &x[0], &x[1], &x[2], &x[3], &d, &d2, &d, &d2)
+	}
+}
@@ -4,6 +4,8 @@
 
 package edwards25519
 
+import "sync"
+
 // Group elements are members of the elliptic curve -x^2 + y^2 = 1 + d * x^2 *
 // y^2 where d = -121665/121666.
 //
@@ -42,11 +44,8 @@ func (p *projectiveGroupElement) Zero() {
 func (p *projectiveGroupElement) Double(r *completedGroupElement) {
 	var t0 fieldElement
 
-	feSquare(&r.X, &p.X)
-	feSquare(&r.Z, &p.Y)
-	feSquare2(&r.T, &p.Z)
 	feAdd(&r.Y, &p.X, &p.Y)
-	feSquare(&t0, &r.Y)
+	feDoublingSquares(&r.X, &r.Z, &r.T, &t0, &p.X, &p.Y, &p.Z, &r.Y)
 	feAdd(&r.Y, &r.Z, &r.X)
 	feSub(&r.Z, &r.Z, &r.X)
 	feSub(&r.X, &t0, &r.Y)
@@ -106,6 +105,42 @@ func (p *extendedGroupElement) ToBytes(s *[32]byte) {
 	s[31] ^= feIsNegative(&x) << 7
 }
 
+// geBatchToBytes encodes the points p one after the other into s, which must
+// be 32*len(p) bytes long. All the points are normalized together with one
+// feInvert and 3(len(p)-1) multiplications, instead of one feInvert each.
+func geBatchToBytes(s []byte, p []*extendedGroupElement) {
+	recip := make([]fieldElement, len(p))
+	for i := range p {
+		feCopy(&recip[i], &p[i].Z)
+	}
+	feBatchInvert(recip)
+
+	var x, y fieldElement
+	var b [32]byte
+	for i := range p {
+		feMul(&x, &p[i].X, &recip[i])
+		feMul(&y, &p[i].Y, &recip[i])
+		feToBytes(&b, &y)
+		b[31] ^= feIsNegative(&x) << 7
+		copy(s[32*i:], b[:])
+	}
+}
+
+// Equal reports whether p and q represent the same point, by comparing
+// the cross products X1*Z2 == X2*Z1 and Y1*Z2 == Y2*Z1 instead of
+// normalizing both points with a field inversion.
+func (p *extendedGroupElement) Equal(q *extendedGroupElement) bool {
+	var a, b, dx, dy fieldElement
+
+	feMul(&a, &p.X, &q.Z)
+	feMul(&b, &q.X, &p.Z)
+	feSub(&dx, &a, &b)
+	feMul(&a, &p.Y, &q.Z)
+	feMul(&b, &q.Y, &p.Z)
+	feSub(&dy, &a, &b)
+	return feIsNonZero(&dx)|feIsNonZero(&dy) == 0
+}
+
 func (p *extendedGroupElement) FromBytes(s []byte) bool {
 	var u, v, v3, vxx, check fieldElement
 
@@ -159,16 +194,11 @@ func (p *extendedGroupElement) String() string {
 // completedGroupElement methods
 
 func (c *completedGroupElement) ToProjective(r *projectiveGroupElement) {
-	feMul(&r.X, &c.X, &c.T)
-	feMul(&r.Y, &c.Y, &c.Z)
-	feMul(&r.Z, &c.Z, &c.T)
+	feMul3(&r.X, &r.Y, &r.Z, &c.X, &c.Y, &c.Z, &c.T, &c.Z, &c.T)
 }
 
 func (c *completedGroupElement) ToExtended(r *extendedGroupElement) {
-	feMul(&r.X, &c.X, &c.T)
-	feMul(&r.Y, &c.Y, &c.Z)
-	feMul(&r.Z, &c.Z, &c.T)
-	feMul(&r.T, &c.X, &c.Y)
+	feMul4(&r.X, &r.Y, &r.Z, &r.T, &c.X, &c.Y, &c.Z, &c.X, &c.T, &c.Z, &c.T, &c.Y)
 }
 
 func (p *preComputedGroupElement) Zero() {
@@ -182,10 +212,7 @@ func (c *completedGroupElement) Add(p *extendedGroupElement, q *cachedGroupEleme
 
 	feAdd(&c.X, &p.Y, &p.X)
 	feSub(&c.Y, &p.Y, &p.X)
-	feMul(&c.Z, &c.X, &q.yPlusX)
-	feMul(&c.Y, &c.Y, &q.yMinusX)
-	feMul(&c.T, &q.T2d, &p.T)
-	feMul(&c.X, &p.Z, &q.Z)
+	feMul4(&c.Z, &c.Y, &c.T, &c.X, &c.X, &c.Y, &q.T2d, &p.Z, &q.yPlusX, &q.yMinusX, &p.T, &q.Z)
 	feAdd(&t0, &c.X, &c.X)
 	feSub(&c.X, &c.Z, &c.Y)
 	feAdd(&c.Y, &c.Z, &c.Y)
@@ -198,10 +225,7 @@ func (c *completedGroupElement) Sub(p *extendedGroupElement, q *cachedGroupEleme
 
 	feAdd(&c.X, &p.Y, &p.X)
 	feSub(&c.Y, &p.Y, &p.X)
-	feMul(&c.Z, &c.X, &q.yMinusX)
-	feMul(&c.Y, &c.Y, &q.yPlusX)
-	feMul(&c.T, &q.T2d, &p.T)
-	feMul(&c.X, &p.Z, &q.Z)
+	feMul4(&c.Z, &c.Y, &c.T, &c.X, &c.X, &c.Y, &q.T2d, &p.Z, &q.yMinusX, &q.yPlusX, &p.T, &q.Z)
 	feAdd(&t0, &c.X, &c.X)
 	feSub(&c.X, &c.Z, &c.Y)
 	feAdd(&c.Y, &c.Z, &c.Y)
@@ -214,9 +238,7 @@ func (c *completedGroupElement) MixedAdd(p *extendedGroupElement, q *preComputed
 
 	feAdd(&c.X, &p.Y, &p.X)
 	feSub(&c.Y, &p.Y, &p.X)
-	feMul(&c.Z, &c.X, &q.yPlusX)
-	feMul(&c.Y, &c.Y, &q.yMinusX)
-	feMul(&c.T, &q.xy2d, &p.T)
+	feMul3(&c.Z, &c.Y, &c.T, &c.X, &c.Y, &q.xy2d, &q.yPlusX, &q.yMinusX, &p.T)
 	feAdd(&t0, &p.Z, &p.Z)
 	feSub(&c.X, &c.Z, &c.Y)
 	feAdd(&c.Y, &c.Z, &c.Y)
@@ -229,9 +251,7 @@ func (c *completedGroupElement) MixedSub(p *extendedGroupElement, q *preComputed
 
 	feAdd(&c.X, &p.Y, &p.X)
 	feSub(&c.Y, &p.Y, &p.X)
-	feMul(&c.Z, &c.X, &q.yMinusX)
-	feMul(&c.Y, &c.Y, &q.yPlusX)
-	feMul(&c.T, &q.xy2d, &p.T)
+	feMul3(&c.Z, &c.Y, &c.T, &c.X, &c.Y, &q.xy2d, &q.yMinusX, &q.yPlusX, &p.T)
 	feAdd(&t0, &p.Z, &p.Z)
 	feSub(&c.X, &c.Z, &c.Y)
 	feAdd(&c.Y, &c.Z, &c.Y)
@@ -340,19 +360,25 @@ func negative(b int32) int32 {
 	return (b >> 31) & 1
 }
 
-func selectPreComputed(t *preComputedGroupElement, pos int32, b int32) {
+func selectPreComputed(t *preComputedGroupElement, table *[8]preComputedGroupElement, b int32) {
 	var minusT preComputedGroupElement
 	bNegative := negative(b)
 	bAbs := b - (((-bNegative) & b) << 1)
 
-	t.Zero()
-	for i := int32(0); i < 8; i++ {
-		t.CMove(&base[pos][i], equal(bAbs, i+1))
-	}
+	lookupPreComputed(t, table[:], bAbs)
 	minusT.Neg(t)
 	t.CMove(&minusT, bNegative)
 }
 
+// lookupPreComputedGeneric sets t to table[b-1], or to the identity if b is
+// 0, in constant time. It is the portable lookupPreComputed.
+func lookupPreComputedGeneric(t *preComputedGroupElement, table []preComputedGroupElement, b int32) {
+	t.Zero()
+	for i := range table {
+		t.CMove(&table[i], equal(b, int32(i+1)))
+	}
+}
+
 // geScalarMultBase computes h = a*B, where
 //   a = a[0]+256*a[1]+...+256^31 a[31]
 //   B is the Ed25519 base point (x,4/5) with x positive.
@@ -360,6 +386,90 @@ func selectPreComputed(t *preComputedGroupElement, pos int32, b int32) {
 // Preconditions:
 //   a[31] <= 127
 func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
+	if useWideBase {
+		geScalarMultBaseWide(h, a)
+		return
+	}
+	geScalarMultPreComputed(h, a, &base)
+}
+
+// baseWide holds the multiples baseWide[i][j] = (j+1)*64^i*B of the base
+// point for geScalarMultBaseWide. It takes 160 KB of memory, and is only
+// built on first use.
+var baseWide struct {
+	once  sync.Once
+	table *[43][32]preComputedGroupElement
+}
+
+// baseWideTable returns baseWide.table, building it if needed.
+func baseWideTable() *[43][32]preComputedGroupElement {
+	baseWide.once.Do(func() {
+		table := new([43][32]preComputedGroupElement)
+		rows := make([][]preComputedGroupElement, len(table))
+		for i := range table {
+			rows[i] = table[i][:]
+		}
+		preComputeRows(rows, &baseext, 6)
+		baseWide.table = table
+	})
+	return baseWide.table
+}
+
+// geScalarMultBaseWide computes h = a*B like geScalarMultBase, with one
+// signed radix 64 digit of a per row of baseWide. This takes 43 additions
+// and no doublings, instead of 64 additions and 4 doublings with the radix
+// 16 table, but every lookup scans 32 entries rather than 8. It is faster
+// where lookupPreComputed is vectorized, see useWideBase.
+//
+// Preconditions:
+//   a[31] <= 127
+func geScalarMultBaseWide(h *extendedGroupElement, a *[32]byte) {
+	table := baseWideTable()
+	var e [43]int32
+
+	for i := range e {
+		k := 6 * i
+		v := int32(a[k/8])
+		if k/8 < 31 {
+			v |= int32(a[k/8+1]) << 8
+		}
+		e[i] = (v >> uint(k%8)) & 63
+	}
+
+	// each e[i] is between 0 and 63 and e[42] is between 0 and 7.
+
+	carry := int32(0)
+	for i := 0; i < 42; i++ {
+		e[i] += carry
+		carry = (e[i] + 32) >> 6
+		e[i] -= carry << 6
+	}
+	e[42] += carry
+	// each e[i] is between -32 and 32.
+
+	h.Zero()
+	var t, minusT preComputedGroupElement
+	var r completedGroupElement
+	for i := range e {
+		bNegative := negative(e[i])
+		bAbs := e[i] - (((-bNegative) & e[i]) << 1)
+		lookupPreComputed(&t, table[i][:], bAbs)
+		minusT.Neg(&t)
+		t.CMove(&minusT, bNegative)
+
+		r.MixedAdd(h, &t)
+		r.ToExtended(h)
+	}
+}
+
+// geScalarMultPreComputed computes h = a*A, where
+//   a = a[0]+256*a[1]+...+256^31 a[31]
+//   table[i][j] = (j+1)*256^i*A, as computed by preComputeTable.
+//
+// Preconditions:
+//   a[31] <= 127
+func geScalarMultPreComputed(h *extendedGroupElement, a *[32]byte,
+	table *[32][8]preComputedGroupElement) {
 	var e [64]int8
 
 	for i, v := range a {
@@ -382,7 +492,7 @@ func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
 	var t preComputedGroupElement
 	var r completedGroupElement
 	for i := int32(1); i < 64; i += 2 {
-		selectPreComputed(&t, i/2, int32(e[i]))
+		selectPreComputed(&t, &table[i/2], int32(e[i]))
 		r.MixedAdd(h, &t)
 		r.ToExtended(h)
 	}
@@ -399,12 +509,73 @@ func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
 	r.ToExtended(h)
 
 	for i := int32(0); i < 64; i += 2 {
-		selectPreComputed(&t, i/2, int32(e[i]))
+		selectPreComputed(&t, &table[i/2], int32(e[i]))
 		r.MixedAdd(h, &t)
 		r.ToExtended(h)
 	}
 }
 
+// preComputeTable fills table with the multiples table[i][j] = (j+1)*256^i*A
+// in affine preComputedGroupElement form, the layout of the base point table,
+// so that geScalarMultPreComputed can multiply A as fast as the base point.
+func preComputeTable(table *[32][8]preComputedGroupElement, A *extendedGroupElement) {
+	var rows [32][]preComputedGroupElement
+	for i := range table {
+		rows[i] = table[i][:]
+	}
+	preComputeRows(rows[:], A, 8)
+}
+
+// preComputeRows fills the rows, which must all have the same length, with
+// the multiples rows[i][j] = (j+1)*2^(shift*i)*A in affine
+// preComputedGroupElement form. All the points are normalized with a single
+// field inversion.
+func preComputeRows(rows [][]preComputedGroupElement, A *extendedGroupElement, shift int) {
+	width := len(rows[0])
+	multiples := make([]extendedGroupElement, len(rows)*width)
+	var t completedGroupElement
+	var r projectiveGroupElement
+	var c cachedGroupElement
+
+	row := *A // 2^(shift*i)*A
+	for i := range rows {
+		m := multiples[width*i : width*(i+1)]
+		m[0] = row
+		row.ToCached(&c)
+		for j := 1; j < width; j++ {
+			t.Add(&m[j-1], &c)
+			t.ToExtended(&m[j])
+		}
+
+		// row <<= shift
+		row.ToProjective(&r)
+		for k := 1; k < shift; k++ {
+			r.Double(&t)
+			t.ToProjective(&r)
+		}
+		r.Double(&t)
+		t.ToExtended(&row)
+	}
+
+	zInv := make([]fieldElement, len(multiples))
+	for k := range multiples {
+		feCopy(&zInv[k], &multiples[k].Z)
+	}
+	feBatchInvert(zInv)
+
+	var x, y fieldElement
+	for k := range multiples {
+		p := &multiples[k]
+		q := &rows[k/width][k%width]
+		feMul(&x, &p.X, &zInv[k])
+		feMul(&y, &p.Y, &zInv[k])
+		feAdd(&q.yPlusX, &y, &x)
+		feSub(&q.yMinusX, &y, &x)
+		feMul(&q.xy2d, &x, &y)
+		feMul(&q.xy2d, &q.xy2d, &d2)
+	}
+}
+
 func selectCached(c *cachedGroupElement, Ai *[8]cachedGroupElement, b int32) {
 	bNegative := negative(b)
 	bAbs := b - (((-bNegative) & b) << 1)
@@ -0,0 +1,24 @@
+// +build amd64,!generic
+
+package edwards25519
+
+// useWideBase selects geScalarMultBaseWide for base point multiplications.
+// Its lookups in rows of 32 entries only pay off when vectorized.
+var useWideBase = hasAVX2
+
+//go:noescape
+func lookupPreComputedAVX2(t *preComputedGroupElement, table []preComputedGroupElement, b int32)
+
+// lookupPreComputed sets t to table[b-1], or to the identity if b is 0, in
+// constant time. Where AVX2 is available, the whole table is scanned with
+// 256-bit masks.
+func lookupPreComputed(t *preComputedGroupElement, table []preComputedGroupElement, b int32) {
+	if hasAVX2 {
+		var u preComputedGroupElement
+		lookupPreComputedAVX2(&u, table, b)
+		t.Zero()
+		t.CMove(&u, 1^equal(b, 0))
+		return
+	}
+	lookupPreComputedGeneric(t, table, b)
+}
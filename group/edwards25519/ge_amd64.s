@@ -0,0 +1,53 @@
+// +build amd64,!generic
+
+#include "textflag.h"
+
+// func lookupPreComputedAVX2(t *preComputedGroupElement, table []preComputedGroupElement, b int32)
+//
+// lookupPreComputedAVX2 sets t to table[b-1], or to zero if b is 0, reading
+// every entry of table. A 120-byte entry is covered by four 32-byte loads,
+// at offsets 0, 32, 64 and 88; the last two overlap, and store the same bytes.
+TEXT ·lookupPreComputedAVX2(SB), NOSPLIT, $0-36
+	MOVQ t+0(FP), DI
+	MOVQ table_base+8(FP), SI
+	MOVQ table_len+16(FP), CX
+
+	// Y15 holds b and Y14 the index of the current entry, in every lane
+	MOVL b+32(FP), AX
+	VMOVD AX, X15
+	VPBROADCASTD X15, Y15
+	MOVL $1, AX
+	VMOVD AX, X13
+	VPBROADCASTD X13, Y13
+	VMOVDQA Y13, Y14
+	VPXOR Y0, Y0, Y0
+	VPXOR Y1, Y1, Y1
+	VPXOR Y2, Y2, Y2
+	VPXOR Y3, Y3, Y3
+
+	TESTQ CX, CX
+	JZ done
+
+loop:
+	// Y12 is all ones iff the index in Y14 is b
+	VPCMPEQD Y14, Y15, Y12
+	VPAND (SI), Y12, Y4
+	VPOR Y4, Y0, Y0
+	VPAND 32(SI), Y12, Y5
+	VPOR Y5, Y1, Y1
+	VPAND 64(SI), Y12, Y6
+	VPOR Y6, Y2, Y2
+	VPAND 88(SI), Y12, Y7
+	VPOR Y7, Y3, Y3
+	VPADDD Y13, Y14, Y14
+	ADDQ $120, SI
+	DECQ CX
+	JNZ loop
+
+done:
+	VMOVDQU Y0, (DI)
+	VMOVDQU Y1, 32(DI)
+	VMOVDQU Y2, 64(DI)
+	VMOVDQU Y3, 88(DI)
+	VZEROUPPER
+	RET
@@ -0,0 +1,13 @@
+// +build !amd64 generic
+
+package edwards25519
+
+// useWideBase selects geScalarMultBaseWide for base point multiplications.
+// Its lookups in rows of 32 entries do not pay off without vectorization.
+const useWideBase = false
+
+// lookupPreComputed sets t to table[b-1], or to the identity if b is 0, in
+// constant time.
+func lookupPreComputed(t *preComputedGroupElement, table []preComputedGroupElement, b int32) {
+	lookupPreComputedGeneric(t, table, b)
+}
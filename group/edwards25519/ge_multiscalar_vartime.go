@@ -0,0 +1,240 @@
+package edwards25519
+
+import "encoding/binary"
+
+// msmPippengerThreshold is the number of terms from which on
+// geMultiScalarMultVartime switches from Straus' interleaved sliding
+// windows to Pippenger's bucket method.
+const msmPippengerThreshold = 190
+
+// geMultiScalarMultVartime computes h = sum_i a[i]*A[i], where
+//   a[i] = a[i][0]+256*a[i][1]+...+256^31 a[i][31]
+//
+// It runs in variable time and must only be used on public inputs.
+//
+// Preconditions:
+//   len(a) == len(A)
+func geMultiScalarMultVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	// slide() requires a[i][31] <= 127, which unreduced scalars,
+	// e.g. decoded from untrusted input, need not satisfy.
+	straus := len(a) < msmPippengerThreshold
+	for i := 0; straus && i < len(a); i++ {
+		straus = a[i][31] <= 127
+	}
+
+	if straus {
+		geMultiScalarMultStraus(h, a, A)
+	} else {
+		geMultiScalarMultPippenger(h, a, A)
+	}
+}
+
+// oddMultiples fills Ai with the odd multiples A,3A,5A,...,15A
+// in addition-ready cached group element form.
+func oddMultiples(Ai *[8]cachedGroupElement, A *extendedGroupElement) {
+	var t completedGroupElement
+	var u, A2 extendedGroupElement
+
+	A.ToCached(&Ai[0])
+	A.Double(&t)
+	t.ToExtended(&A2)
+	for i := 0; i < 7; i++ {
+		t.Add(&A2, &Ai[i])
+		t.ToExtended(&u)
+		u.ToCached(&Ai[i+1])
+	}
+}
+
+// geMultiScalarMultStraus computes h = sum_i a[i]*A[i] by sliding over
+// all the scalars at once, so that the doublings are shared between
+// all the terms and only the additions grow with the number of terms.
+//
+// Preconditions:
+//   a[i][31] <= 127
+func geMultiScalarMultStraus(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	aSlide := make([][256]int8, len(a))
+	Ai := make([][8]cachedGroupElement, len(a))
+	for j := range a {
+		slide(&aSlide[j], a[j])
+		oddMultiples(&Ai[j], A[j])
+	}
+
+	// Find the most-significant nonzero clump of bits over all scalars
+	top := -1
+	for j := range aSlide {
+		for i := 255; i > top; i-- {
+			if aSlide[j][i] != 0 {
+				top = i
+				break
+			}
+		}
+	}
+	if top < 0 { // no bits set
+		h.Zero()
+		return
+	}
+
+	var t completedGroupElement
+	var u extendedGroupElement
+	var r projectiveGroupElement
+
+	r.Zero()
+	for i := top; i >= 0; i-- {
+		r.Double(&t)
+
+		for j := range aSlide {
+			if aSlide[j][i] > 0 {
+				t.ToExtended(&u)
+				t.Add(&u, &Ai[j][aSlide[j][i]/2])
+			} else if aSlide[j][i] < 0 {
+				t.ToExtended(&u)
+				t.Sub(&u, &Ai[j][(-aSlide[j][i])/2])
+			}
+		}
+
+		t.ToProjective(&r)
+	}
+
+	t.ToExtended(h)
+}
+
+// pippengerWindow returns the bucket window width in bits
+// for a linear combination of n terms.
+func pippengerWindow(n int) uint {
+	switch {
+	case n < 500:
+		return 6
+	case n < 800:
+		return 7
+	default:
+		return 8
+	}
+}
+
+// signedRadix expands the 32-byte exponent a into len(r) signed digits
+// in radix 2^w, each between -2^(w-1) and 2^(w-1)-1, such that
+//   a = r[0] + 2^w*r[1] + 2^(2w)*r[2] + ...
+// The caller must provide at least ceil(256/w)+1 digits.
+func signedRadix(r []int32, a *[32]byte, w uint) {
+	var limbs [4]uint64
+	for i := range limbs {
+		limbs[i] = binary.LittleEndian.Uint64(a[8*i:])
+	}
+
+	radix := uint64(1) << w
+	carry := uint64(0)
+	for i := range r {
+		pos := uint(i) * w
+		idx, off := pos/64, pos%64
+		var v uint64
+		if idx < 4 {
+			v = limbs[idx] >> off
+			if off+w > 64 && idx < 3 {
+				v |= limbs[idx+1] << (64 - off)
+			}
+		}
+		v = (v & (radix - 1)) + carry
+
+		// Recenter the digit around zero, pushing the excess
+		// into the next, more-significant digit.
+		carry = (v + radix/2) >> w
+		r[i] = int32(v) - int32(carry<<w)
+	}
+}
+
+// geMultiScalarMultPippenger computes h = sum_i a[i]*A[i] using Pippenger's
+// bucket method: for each window of w bits, each point is added to the
+// bucket selected by its signed digit, and the buckets are then summed up
+// with their weights using a running sum.
+func geMultiScalarMultPippenger(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	w := pippengerWindow(len(a))
+	windows := (256+int(w)-1)/int(w) + 1
+
+	digits := make([]int32, len(a)*windows)
+	Ac := make([]cachedGroupElement, len(a))
+	for j := range a {
+		signedRadix(digits[j*windows:(j+1)*windows], a[j], w)
+		A[j].ToCached(&Ac[j])
+	}
+
+	buckets := make([]extendedGroupElement, 1<<(w-1))
+	used := make([]bool, len(buckets))
+
+	var t completedGroupElement
+	var r projectiveGroupElement
+	var c cachedGroupElement
+	var q, sum, acc extendedGroupElement
+
+	// Accumulate into q, since h may alias one of the points
+	q.Zero()
+	for win := windows - 1; win >= 0; win-- {
+
+		// q <<= w
+		if win != windows-1 {
+			q.ToProjective(&r)
+			for k := uint(0); k < w-1; k++ {
+				r.Double(&t)
+				t.ToProjective(&r)
+			}
+			r.Double(&t)
+			t.ToExtended(&q)
+		}
+
+		// Sort the points into the buckets of their digit's magnitude
+		for k := range used {
+			used[k] = false
+		}
+		for j := range Ac {
+			d := digits[j*windows+win]
+			if d > 0 {
+				if used[d-1] {
+					t.Add(&buckets[d-1], &Ac[j])
+					t.ToExtended(&buckets[d-1])
+				} else {
+					buckets[d-1] = *A[j]
+					used[d-1] = true
+				}
+			} else if d < 0 {
+				if used[-d-1] {
+					t.Sub(&buckets[-d-1], &Ac[j])
+					t.ToExtended(&buckets[-d-1])
+				} else {
+					buckets[-d-1].Neg(A[j])
+					used[-d-1] = true
+				}
+			}
+		}
+
+		// acc = sum_k (k+1)*buckets[k], computed as a sum of running sums
+		sum.Zero()
+		acc.Zero()
+		nonzero := false
+		for k := len(buckets) - 1; k >= 0; k-- {
+			if used[k] {
+				buckets[k].ToCached(&c)
+				t.Add(&sum, &c)
+				t.ToExtended(&sum)
+				nonzero = true
+			}
+			if nonzero {
+				sum.ToCached(&c)
+				t.Add(&acc, &c)
+				t.ToExtended(&acc)
+			}
+		}
+
+		if nonzero {
+			acc.ToCached(&c)
+			t.Add(&q, &c)
+			t.ToExtended(&q)
+		}
+	}
+
+	*h = q
+}
@@ -0,0 +1,181 @@
+package edwards25519
+
+import (
+	"crypto/sha512"
+
+	"go.dedis.ch/kyber/v3"
+)
+
+// hashDST is the domain separation tag that Hash uses, following the
+// naming convention of RFC 9380, section 3.1.
+const hashDST = "KYBER-V01-CS02-with-edwards25519_XMD:SHA-512_ELL2_RO_"
+
+// Hash sets P to the hash of m onto the prime-order subgroup, with the
+// edwards25519_XMD:SHA-512_ELL2_RO_ suite of RFC 9380 and kyber's own
+// domain separation tag. It runs in constant time, without the retries of
+// Pick and Embed, and costs about as much as a base point multiplication.
+func (P *point) Hash(m []byte) kyber.Point {
+	return P.HashWithDST(m, []byte(hashDST))
+}
+
+// HashWithDST sets P to the hash of m onto the prime-order subgroup, with the
+// edwards25519_XMD:SHA-512_ELL2_RO_ suite of RFC 9380 and the domain
+// separation tag dst, which should be unique to the application and
+// protocol. Tags longer than 255 bytes are hashed as the RFC specifies.
+func (P *point) HashWithDST(m, dst []byte) kyber.Point {
+	var uniform [96]byte
+	var u fieldElement
+	var q extendedGroupElement
+	var c cachedGroupElement
+	var r completedGroupElement
+	var s projectiveGroupElement
+
+	expandMessageXMD(uniform[:], m, dst)
+	feFromHashBytes(&u, uniform[:48])
+	P.ge.Elligator2(&u)
+	feFromHashBytes(&u, uniform[48:])
+	q.Elligator2(&u)
+
+	q.ToCached(&c)
+	r.Add(&P.ge, &c)
+
+	// Clear the cofactor by multiplying by 8
+	r.ToProjective(&s)
+	s.Double(&r)
+	r.ToProjective(&s)
+	s.Double(&r)
+	r.ToProjective(&s)
+	s.Double(&r)
+	r.ToExtended(&P.ge)
+	return P
+}
+
+// expandMessageXMD fills out with expand_message_xmd of RFC 9380, section
+// 5.3.1, using SHA-512. out must be at most 255*64 bytes long.
+func expandMessageXMD(out []byte, msg, dst []byte) {
+	h := sha512.New()
+	if len(dst) > 255 {
+		_, _ = h.Write([]byte("H2C-OVERSIZE-DST-"))
+		_, _ = h.Write(dst)
+		dst = h.Sum(nil)
+		h.Reset()
+	}
+	dstLen := []byte{byte(len(dst))}
+
+	// b_0 = H(Z_pad || msg || l_i_b_str || 0 || DST_prime)
+	var zPad [128]byte
+	_, _ = h.Write(zPad[:])
+	_, _ = h.Write(msg)
+	_, _ = h.Write([]byte{byte(len(out) >> 8), byte(len(out)), 0})
+	_, _ = h.Write(dst)
+	_, _ = h.Write(dstLen)
+	var b0, bi [sha512.Size]byte
+	h.Sum(b0[:0])
+
+	// b_i = H((b_0 xor b_(i-1)) || i || DST_prime), taking b_0 for b_1's input
+	for i := 1; len(out) > 0; i++ {
+		for j := range bi {
+			bi[j] ^= b0[j]
+		}
+		h.Reset()
+		_, _ = h.Write(bi[:])
+		_, _ = h.Write([]byte{byte(i)})
+		_, _ = h.Write(dst)
+		_, _ = h.Write(dstLen)
+		h.Sum(bi[:0])
+		out = out[copy(out, bi[:]):]
+	}
+}
+
+// feFromHashBytes sets dst to the 48-byte big-endian integer b modulo p,
+// as hash_to_field of RFC 9380 reads it.
+func feFromHashBytes(dst *fieldElement, b []byte) {
+	var lo, hi [32]byte
+	for i := 0; i < 32; i++ {
+		lo[i] = b[47-i]
+	}
+	for i := 0; i < 16; i++ {
+		hi[i] = b[15-i]
+	}
+
+	// b = lo + 2^255*top + 2^256*hi, where 2^255 = 19 and 2^256 = 38
+	top := int32(lo[31] >> 7)
+	var l, h, t fieldElement
+	feFromBytes(&l, lo[:])
+	feFromBytes(&h, hi[:])
+	feMul(&h, &h, &fieldElement{38})
+	feAdd(dst, &l, &h)
+	feAdd(&t, dst, &fieldElement{19})
+	feCMove(dst, &t, top)
+}
+
+// Elligator2 sets p to the image of u under map_to_curve_elligator2_edwards25519
+// of RFC 9380, appendix G.2, which does not clear the cofactor.
+func (p *extendedGroupElement) Elligator2(u *fieldElement) {
+	var one, tv1, tv2, tv3, xd, x1n, x2n, gxd, gx1, gx2 fieldElement
+	var y11, y12, y21, y22, y1, y2, xn, y, negY fieldElement
+
+	// Map to Curve25519, following appendix G.2.1
+	feOne(&one)
+	feSquare(&tv1, u)
+	feAdd(&tv1, &tv1, &tv1) // 2u^2
+	feAdd(&xd, &tv1, &one)  // 1 + 2u^2, which is never zero
+	feNeg(&x1n, &paramA)    // x1 = -A/(1 + 2u^2)
+	feSquare(&tv2, &xd)
+	feMul(&gxd, &tv2, &xd) // xd^3
+	feMul(&gx1, &paramA, &tv1)
+	feMul(&gx1, &gx1, &x1n)
+	feAdd(&gx1, &gx1, &tv2)
+	feMul(&gx1, &gx1, &x1n) // x1n^3 + A*x1n^2*xd + x1n*xd^2
+	feSquare(&tv3, &gxd)
+	feSquare(&tv2, &tv3)    // gxd^4
+	feMul(&tv3, &tv3, &gxd) // gxd^3
+	feMul(&tv3, &tv3, &gx1) // gx1*gxd^3
+	feMul(&tv2, &tv2, &tv3) // gx1*gxd^7
+	fePow22523(&y11, &tv2)
+	feMul(&y11, &y11, &tv3) // gx1*gxd^3*(gx1*gxd^7)^((p-5)/8)
+	feMul(&y12, &y11, &sqrtM1)
+	feSquare(&tv2, &y11)
+	feMul(&tv2, &tv2, &gxd)
+	feCopy(&y1, &y12)
+	feCMove(&y1, &y11, feEqual(&tv2, &gx1)) // sqrt of g(x1), if square
+
+	feMul(&x2n, &x1n, &tv1) // x2 = 2u^2*x1
+	feMul(&y21, &y11, u)
+	feMul(&y21, &y21, &ell2C2)
+	feMul(&y22, &y21, &sqrtM1)
+	feMul(&gx2, &gx1, &tv1) // g(x2) = 2u^2*g(x1)
+	feSquare(&tv2, &y21)
+	feMul(&tv2, &tv2, &gxd)
+	feCopy(&y2, &y22)
+	feCMove(&y2, &y21, feEqual(&tv2, &gx2)) // sqrt of g(x2), if square
+
+	feSquare(&tv2, &y1)
+	feMul(&tv2, &tv2, &gxd)
+	e3 := feEqual(&tv2, &gx1)
+	feCopy(&xn, &x2n)
+	feCMove(&xn, &x1n, e3)
+	feCopy(&y, &y2)
+	feCMove(&y, &y1, e3)
+	feNeg(&negY, &y)
+	feCMove(&y, &negY, e3^int32(feIsNegative(&y)))
+
+	// Map (xn/xd, y) to edwards25519, following appendix G.2.2:
+	//   x = sqrt(-(A+2))*xM/yM, y = (xM-1)/(xM+1)
+	var exn, exd, eyn, eyd fieldElement
+	feMul(&exn, &xn, &sqrtMinusAPlus2)
+	feMul(&exd, &xd, &y)
+	feSub(&eyn, &xn, &xd)
+	feAdd(&eyd, &xn, &xd)
+	feMul(&tv1, &exd, &eyd)
+	e := 1 ^ feIsNonZero(&tv1)
+	feCMove(&exn, &fieldElement{}, e)
+	feCMove(&exd, &one, e)
+	feCMove(&eyn, &one, e)
+	feCMove(&eyd, &one, e)
+
+	feMul(&p.X, &exn, &eyd)
+	feMul(&p.Y, &eyn, &exd)
+	feMul(&p.Z, &exd, &eyd)
+	feMul(&p.T, &exn, &eyn)
+}
@@ -0,0 +1,90 @@
+package edwards25519
+
+import (
+	"encoding/hex"
+	"math/big"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// Test vectors from RFC 9380, appendix K.3.
+func TestExpandMessageXMD(t *testing.T) {
+	dst := []byte("QUUX-V01-CS02-with-expander-SHA512-256")
+	vectors := []struct {
+		msg string
+		len int
+		out string
+	}{
+		{"", 0x20, "6b9a7312411d92f921c6f68ca0b6380730a1a4d982c507211a90964c394179ba"},
+		{"abc", 0x20, "0da749f12fbe5483eb066a5f595055679b976e93abe9be6f0f6318bce7aca8dc"},
+		{"abc", 0x80, "7f1dddd13c08b543f2e2037b14cefb255b44c83cc397c1786d975653e36a6b11" +
+			"bdd7732d8b38adb4a0edc26a0cef4bb45217135456e58fbca1703cd6032cb134" +
+			"7ee720b87972d63fbf232587043ed2901bce7f22610c0419751c065922b48843" +
+			"1851041310ad659e4b23520e1772ab29dcdeb2002222a363f0c2b1c972b3efe1"},
+	}
+	for _, v := range vectors {
+		out := make([]byte, v.len)
+		expandMessageXMD(out, []byte(v.msg), dst)
+		require.Equal(t, v.out, hex.EncodeToString(out))
+	}
+}
+
+// Test vectors from RFC 9380, appendix J.5.1.
+func TestPoint_HashWithDST(t *testing.T) {
+	dst := []byte("QUUX-V01-CS02-with-edwards25519_XMD:SHA-512_ELL2_RO_")
+	vectors := []struct{ msg, x, y string }{
+		{"",
+			"3c3da6925a3c3c268448dcabb47ccde5439559d9599646a8260e47b1e4822fc6",
+			"09a6c8561a0b22bef63124c588ce4c62ea83a3c899763af26d795302e115dc21"},
+		{"abc",
+			"608040b42285cc0d72cbb3985c6b04c935370c7361f4b7fbdb1ae7f8c1a8ecad",
+			"1a8395b88338f22e435bbd301183e7f20a5f9de643f11882fb237f88268a5531"},
+		{"abcdef0123456789",
+			"6d7fabf47a2dc03fe7d47f7dddd21082c5fb8f86743cd020f3fb147d57161472",
+			"53060a3d140e7fbcda641ed3cf42c88a75411e648a1add71217f70ea8ec561a6"},
+		{strings.Repeat("a", 512),
+			"4d2774bf181e2c39c20a654aa41fc05e0849d61c909f5bfbaa463131e7935ea0",
+			"7771c473131cdd4193c37f0c0b25c57e222e20f36350266bd48789a169006f57"},
+	}
+	for _, v := range vectors {
+		x, _ := new(big.Int).SetString(v.x, 16)
+		y, _ := new(big.Int).SetString(v.y, 16)
+
+		// The encoding is y in little-endian, with the sign of x on top
+		var exp [32]byte
+		yb := y.Bytes()
+		for i := range yb {
+			exp[i] = yb[len(yb)-1-i]
+		}
+		exp[31] |= byte(x.Bit(0)) << 7
+
+		p := tSuite.Point().(*point).HashWithDST([]byte(v.msg), dst)
+		require.Equal(t, hex.EncodeToString(exp[:]), p.String())
+	}
+}
+
+func TestPoint_Hash(t *testing.T) {
+	p := tSuite.Point().(*point).Hash([]byte("hello"))
+	q := tSuite.Point().(*point).Hash([]byte("hello"))
+	require.True(t, p.Equal(q))
+	require.False(t, p.Equal(tSuite.Point().(*point).Hash([]byte("hello!"))))
+
+	// The hashes land in the prime-order subgroup
+	require.True(t, tSuite.Point().Mul(primeOrderScalar, p).Equal(nullPoint))
+	require.False(t, p.Equal(nullPoint))
+
+	// Tags over 255 bytes are hashed first
+	long := []byte(strings.Repeat("x", 300))
+	q.(*point).HashWithDST([]byte("hello"), long)
+	require.False(t, p.Equal(q))
+}
+
+func BenchmarkPointHash(b *testing.B) {
+	p := tSuite.Point().(*point)
+	msg := []byte("hello world")
+	for i := 0; i < b.N; i++ {
+		p.Hash(msg)
+	}
+}
@@ -1,13 +1,212 @@
 package edwards25519
 
 import (
+	"crypto/sha512"
 	"fmt"
 	"testing"
 
 	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
 )
 
 func TestPoint_Marshal(t *testing.T) {
 	p := point{}
 	require.Equal(t, "ed.point", fmt.Sprintf("%s", p.MarshalID()))
 }
+
+func TestPoint_MultiScalarMul(t *testing.T) {
+	// Cover both the Straus and the Pippenger code paths.
+	for _, n := range []int{0, 1, 2, 7, msmPippengerThreshold + 3} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		expected := tSuite.Point().Null()
+		for i := range scalars {
+			scalars[i] = tSuite.Scalar().Pick(tSuite.RandomStream())
+			if i%5 != 4 {
+				points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+			}
+			expected.Add(expected, tSuite.Point().Mul(scalars[i], points[i]))
+		}
+		res := tSuite.Point().(*point).MultiScalarMul(scalars, points)
+		require.True(t, res.Equal(expected), "n = %d", n)
+	}
+
+	// Double scalar multiplication with the base point, in both orders.
+	for i := 0; i < 2; i++ {
+		scalars := []kyber.Scalar{tSuite.Scalar().Pick(tSuite.RandomStream()),
+			tSuite.Scalar().Pick(tSuite.RandomStream())}
+		points := []kyber.Point{tSuite.Point().Pick(tSuite.RandomStream()), nil}
+		points[0], points[1] = points[i], points[1-i]
+		expected := tSuite.Point().Add(tSuite.Point().Mul(scalars[0], points[0]),
+			tSuite.Point().Mul(scalars[1], points[1]))
+		res := tSuite.Point().(*point).MultiScalarMul(scalars, points)
+		require.True(t, res.Equal(expected))
+	}
+
+	// Scalars with few bits set and the receiver aliasing an input point.
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	scalars := []kyber.Scalar{tSuite.Scalar().SetInt64(3), tSuite.Scalar().Zero()}
+	points := []kyber.Point{p, tSuite.Point().Base()}
+	expected := tSuite.Point().Mul(scalars[0], p)
+	p.(*point).MultiScalarMul(scalars, points)
+	require.True(t, p.Equal(expected))
+}
+
+func BenchmarkPointMultiScalarMul(b *testing.B) {
+	for _, n := range []int{16, 256, 1024} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		for i := range scalars {
+			scalars[i] = tSuite.Scalar().Pick(tSuite.RandomStream())
+			points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+		}
+		b.Run(fmt.Sprintf("n=%d", n), func(b *testing.B) {
+			p := tSuite.Point().(*point)
+			for i := 0; i < b.N; i++ {
+				p.MultiScalarMul(scalars, points)
+			}
+		})
+	}
+}
+
+func TestPoint_Precompute(t *testing.T) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	q := p.Clone()
+	p.(kyber.Precomputable).Precompute()
+	require.NotNil(t, p.(*point).precomputedTable())
+
+	for i := 0; i < 10; i++ {
+		s := tSuite.Scalar().Pick(tSuite.RandomStream())
+		require.True(t, tSuite.Point().Mul(s, p).Equal(tSuite.Point().Mul(s, q)))
+	}
+
+	// The table is shared by copies, and dropped when the value changes.
+	c := tSuite.Point().Set(p)
+	require.NotNil(t, c.(*point).precomputedTable())
+	p.Add(p, p)
+	require.Nil(t, p.(*point).precomputedTable())
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+	q.Add(q, q)
+	require.True(t, tSuite.Point().Mul(s, p).Equal(tSuite.Point().Mul(s, q)))
+
+	// Multiplying a point by itself in place must not use a stale table.
+	c.Mul(s, c)
+	require.Nil(t, c.(*point).precomputedTable())
+}
+
+func TestPoint_MulBaseWide(t *testing.T) {
+	// Compare both base point tables, on edge and random scalars.
+	var scalars [][32]byte
+	for _, v := range []int64{0, 1, 31, 32, 33, 63, 64, 255, 256, -1, -32} {
+		scalars = append(scalars, new(scalar).SetInt64(v).(*scalar).v)
+	}
+	var max [32]byte
+	for i := range max {
+		max[i] = 0xff
+	}
+	max[31] = 127
+	scalars = append(scalars, max)
+	for i := 0; i < 50; i++ {
+		scalars = append(scalars, tSuite.Scalar().Pick(tSuite.RandomStream()).(*scalar).v)
+	}
+
+	var p, q extendedGroupElement
+	for i := range scalars {
+		geScalarMultBaseWide(&p, &scalars[i])
+		geScalarMultPreComputed(&q, &scalars[i], &base)
+		require.True(t, p.Equal(&q), "scalar %x", scalars[i])
+	}
+
+	// Both tables start with B, 2B, ..., 8B.
+	table := baseWideTable()
+	var x, y [32]byte
+	for j := range base[0] {
+		u, v := &base[0][j], &table[0][j]
+		for _, fe := range [][2]*fieldElement{{&u.yPlusX, &v.yPlusX},
+			{&u.yMinusX, &v.yMinusX}, {&u.xy2d, &v.xy2d}} {
+			feToBytes(&x, fe[0])
+			feToBytes(&y, fe[1])
+			require.Equal(t, x, y)
+		}
+	}
+}
+
+func BenchmarkPointPrecompute(b *testing.B) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	for i := 0; i < b.N; i++ {
+		p.(*point).precomputed = nil
+		p.(*point).Precompute()
+	}
+}
+
+func BenchmarkPointMulPrecomputed(b *testing.B) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	p.(*point).Precompute()
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+	r := tSuite.Point()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		r.Mul(s, p)
+	}
+}
+
+func TestPoint_Equal(t *testing.T) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+
+	// Same point reached through different projective representations
+	q := tSuite.Point().Mul(s, p)
+	q.Add(q, p)
+	r := tSuite.Point().Mul(tSuite.Scalar().Add(s, tSuite.Scalar().One()), p)
+	require.True(t, q.Equal(r))
+	require.True(t, r.Equal(q))
+
+	// -q shares its y coordinate with q
+	require.False(t, q.Equal(tSuite.Point().Neg(q)))
+	require.False(t, q.Equal(tSuite.Point().Null()))
+	require.True(t, tSuite.Point().Sub(q, r).Equal(tSuite.Point().Null()))
+}
+
+func BenchmarkPointEqual(b *testing.B) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	q := tSuite.Point().Add(p, tSuite.Point().Null())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Equal(q)
+	}
+}
+
+func TestPoint_AppendBinaryAllocs(t *testing.T) {
+	p := tSuite.Point().Pick(tSuite.RandomStream())
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+	buf := make([]byte, 0, 64)
+	h := sha512.New()
+	allocs := testing.AllocsPerRun(100, func() {
+		b, _ := kyber.AppendBinary(buf, p)
+		_, _ = kyber.AppendBinary(b, s)
+		_, _ = p.MarshalTo(h)
+		_, _ = s.MarshalTo(h)
+	})
+	require.Equal(t, 0.0, allocs)
+}
+
+func BenchmarkPointMarshalPoints(b *testing.B) {
+	points := make([]kyber.Point, 1000)
+	for i := range points {
+		points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+	}
+	buf := make([]byte, 32*len(points))
+	b.Run("one-by-one", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			for j, p := range points {
+				pb, _ := p.MarshalBinary()
+				copy(buf[32*j:], pb)
+			}
+		}
+	})
+	b.Run("batch", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			_ = tSuite.MarshalPoints(buf, points)
+		}
+	})
+}
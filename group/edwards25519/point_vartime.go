@@ -1,5 +1,7 @@
 package edwards25519
 
+import "go.dedis.ch/kyber/v3"
+
 // AllowVarTime sets a flag in this object which determines if a faster
 // but variable time implementation can be used. Set this only on Points
 // which represent public information. Using variable time algorithms to
@@ -7,3 +9,42 @@ package edwards25519
 func (P *point) AllowVarTime(varTime bool) {
 	P.varTime = varTime
 }
+
+// MultiScalarMul sets P to the linear combination
+//   scalars[0]*points[0] + ... + scalars[n-1]*points[n-1]
+// and returns P. A nil entry in points stands for the standard base point.
+// The sum is computed with Straus' method for few terms and with
+// Pippenger's bucket method for many terms, sharing the doublings between
+// all the terms. The frequent a*A + b*B of signature verification uses the
+// precomputed multiples of the base point. This is much faster than a
+// sequence of Mul and Add, but runs in variable time: use it only on public
+// Scalars and Points.
+func (P *point) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("edwards25519: mismatched number of scalars and points")
+	}
+	if len(points) == 2 && (points[0] == nil) != (points[1] == nil) {
+		i, j := 0, 1 // scalars[i]*points[i] + scalars[j]*B
+		if points[0] == nil {
+			i, j = 1, 0
+		}
+		a := &scalars[i].(*scalar).v
+		b := &scalars[j].(*scalar).v
+		if a[31] <= 127 && b[31] <= 127 {
+			geDoubleScalarMultVartime(&P.ge, a, &points[i].(*point).ge, b)
+			return P
+		}
+	}
+	a := make([]*[32]byte, len(scalars))
+	A := make([]*extendedGroupElement, len(points))
+	for i := range scalars {
+		a[i] = &scalars[i].(*scalar).v
+		if points[i] == nil {
+			A[i] = &baseext
+		} else {
+			A[i] = &points[i].(*point).ge
+		}
+	}
+	geMultiScalarMultVartime(&P.ge, a, A)
+	return P
+}
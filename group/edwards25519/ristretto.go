@@ -0,0 +1,398 @@
+package edwards25519
+
+import (
+	"crypto/cipher"
+	"crypto/sha512"
+	"crypto/subtle"
+	"encoding/hex"
+	"errors"
+	"io"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+)
+
+var marshalRistrettoPointID = [8]byte{'r', '2', '5', '5', '.', 'p', 'n', 't'}
+
+// Ristretto255 is the prime-order group ristretto255 of RFC 9496, built on
+// the Ed25519 curve. Its elements are the classes of Ed25519 points that
+// differ by a point of small order, so that unlike with Curve there is no
+// cofactor to clear or check: every valid encoding is an element of the
+// group of prime order l, and each element has a single encoding.
+// The Scalars are the same as those of Curve.
+type Ristretto255 struct {
+}
+
+// String returns the name of the group, "Ristretto255".
+func (r *Ristretto255) String() string {
+	return "Ristretto255"
+}
+
+// ScalarLen returns 32, the size in bytes of an encoded Scalar.
+func (r *Ristretto255) ScalarLen() int {
+	return 32
+}
+
+// Scalar creates a new Scalar modulo the prime order l of the group.
+func (r *Ristretto255) Scalar() kyber.Scalar {
+	return &scalar{}
+}
+
+// PointLen returns 32, the size in bytes of an encoded Point.
+func (r *Ristretto255) PointLen() int {
+	return 32
+}
+
+// Point creates a new Point of the Ristretto255 group.
+func (r *Ristretto255) Point() kyber.Point {
+	return new(ristrettoPoint)
+}
+
+type ristrettoPoint struct {
+	ge extendedGroupElement
+}
+
+func (P *ristrettoPoint) String() string {
+	var b [32]byte
+	P.ge.RistrettoToBytes(&b)
+	return hex.EncodeToString(b[:])
+}
+
+func (P *ristrettoPoint) MarshalSize() int {
+	return 32
+}
+
+func (P *ristrettoPoint) MarshalBinary() ([]byte, error) {
+	var b [32]byte
+	P.ge.RistrettoToBytes(&b)
+	return b[:], nil
+}
+
+// AppendBinary appends the binary representation of P to buf.
+func (P *ristrettoPoint) AppendBinary(buf []byte) ([]byte, error) {
+	var b [32]byte
+	P.ge.RistrettoToBytes(&b)
+	return append(buf, b[:]...), nil
+}
+
+// MarshalID returns the type tag used in encoding/decoding
+func (P *ristrettoPoint) MarshalID() [8]byte {
+	return marshalRistrettoPointID
+}
+
+// UnmarshalBinary decodes the canonical encoding of a group element, and
+// rejects all the other byte strings.
+func (P *ristrettoPoint) UnmarshalBinary(b []byte) error {
+	if !P.ge.RistrettoFromBytes(b) {
+		return errors.New("invalid Ristretto255 point")
+	}
+	return nil
+}
+
+func (P *ristrettoPoint) MarshalTo(w io.Writer) (int, error) {
+	return marshalling.PointMarshalTo(P, w)
+}
+
+func (P *ristrettoPoint) UnmarshalFrom(r io.Reader) (int, error) {
+	return marshalling.PointUnmarshalFrom(P, r)
+}
+
+// Equal tests whether P and P2 represent the same group element, i.e.
+// whether their Ed25519 points differ by a point of small order.
+func (P *ristrettoPoint) Equal(P2 kyber.Point) bool {
+	q := &P2.(*ristrettoPoint).ge
+	var a, b fieldElement
+
+	// x1*y2 == y1*x2 || y1*y2 == x1*x2
+	feMul(&a, &P.ge.X, &q.Y)
+	feMul(&b, &P.ge.Y, &q.X)
+	eq := feEqual(&a, &b)
+	feMul(&a, &P.ge.Y, &q.Y)
+	feMul(&b, &P.ge.X, &q.X)
+	eq |= feEqual(&a, &b)
+	return eq == 1
+}
+
+// Set point to be equal to P2.
+func (P *ristrettoPoint) Set(P2 kyber.Point) kyber.Point {
+	P.ge = P2.(*ristrettoPoint).ge
+	return P
+}
+
+// Clone returns a copy of P.
+func (P *ristrettoPoint) Clone() kyber.Point {
+	return &ristrettoPoint{ge: P.ge}
+}
+
+// Set to the neutral element.
+func (P *ristrettoPoint) Null() kyber.Point {
+	P.ge.Zero()
+	return P
+}
+
+// Set to the standard generator, the class of the Ed25519 base point.
+func (P *ristrettoPoint) Base() kyber.Point {
+	P.ge = baseext
+	return P
+}
+
+func (P *ristrettoPoint) EmbedLen() int {
+	// Reserve the least-significant 8 bits, which must be even, and the
+	// most-significant 16 bits for pseudo-randomness, and 8 bits for the
+	// embedded data length.
+	return (255 - 8 - 16 - 8) / 8
+}
+
+// Embed sets P to a random element whose encoding holds the data, trying
+// random encodings until one is valid, or to a uniformly random element
+// without any retries if data is nil.
+func (P *ristrettoPoint) Embed(data []byte, rand cipher.Stream) kyber.Point {
+	if data == nil {
+		var b [64]byte
+		rand.XORKeyStream(b[:], b[:])
+		return P.SetUniformBytes(b[:])
+	}
+
+	// How many bytes to embed?
+	dl := P.EmbedLen()
+	if dl > len(data) {
+		dl = len(data)
+	}
+
+	for {
+		var b [32]byte
+		rand.XORKeyStream(b[:], b[:])
+		b[0] &^= 1            // Encodings are non-negative
+		b[1] = byte(dl)       // Encode length in second byte
+		copy(b[2:2+dl], data) // Copy in data to embed
+		b[31] &= 0x7f
+		if P.ge.RistrettoFromBytes(b[:]) {
+			return P
+		}
+	}
+}
+
+// Pick sets P to a uniformly random element of the group.
+func (P *ristrettoPoint) Pick(rand cipher.Stream) kyber.Point {
+	return P.Embed(nil, rand)
+}
+
+// Extract embedded data from a point group element
+func (P *ristrettoPoint) Data() ([]byte, error) {
+	var b [32]byte
+	P.ge.RistrettoToBytes(&b)
+	dl := int(b[1]) // extract length byte
+	if dl > P.EmbedLen() {
+		return nil, errors.New("invalid embedded data length")
+	}
+	return b[2 : 2+dl], nil
+}
+
+// SetUniformBytes sets P to the image of the 64-byte string b under the
+// one-way map of RFC 9496, which maps uniformly random strings to uniformly
+// random group elements without revealing their discrete logarithms.
+func (P *ristrettoPoint) SetUniformBytes(b []byte) kyber.Point {
+	if len(b) != 64 {
+		panic("edwards25519: Ristretto255 uniform bytes must be 64 bytes long")
+	}
+	var t fieldElement
+	var q extendedGroupElement
+	var c cachedGroupElement
+	var r completedGroupElement
+
+	feFromBytes(&t, b[:32])
+	P.ge.RistrettoElligator(&t)
+	feFromBytes(&t, b[32:])
+	q.RistrettoElligator(&t)
+
+	q.ToCached(&c)
+	r.Add(&P.ge, &c)
+	r.ToExtended(&P.ge)
+	return P
+}
+
+// Hash sets P to the image of the SHA-512 digest of m under the one-way map
+// of SetUniformBytes, in constant time and without retries.
+func (P *ristrettoPoint) Hash(m []byte) kyber.Point {
+	h := sha512.Sum512(m)
+	return P.SetUniformBytes(h[:])
+}
+
+func (P *ristrettoPoint) Add(P1, P2 kyber.Point) kyber.Point {
+	E1 := P1.(*ristrettoPoint)
+	E2 := P2.(*ristrettoPoint)
+
+	var t2 cachedGroupElement
+	var r completedGroupElement
+
+	E2.ge.ToCached(&t2)
+	r.Add(&E1.ge, &t2)
+	r.ToExtended(&P.ge)
+
+	return P
+}
+
+func (P *ristrettoPoint) Sub(P1, P2 kyber.Point) kyber.Point {
+	E1 := P1.(*ristrettoPoint)
+	E2 := P2.(*ristrettoPoint)
+
+	var t2 cachedGroupElement
+	var r completedGroupElement
+
+	E2.ge.ToCached(&t2)
+	r.Sub(&E1.ge, &t2)
+	r.ToExtended(&P.ge)
+
+	return P
+}
+
+// Neg finds the negative of point A.
+func (P *ristrettoPoint) Neg(A kyber.Point) kyber.Point {
+	P.ge.Neg(&A.(*ristrettoPoint).ge)
+	return P
+}
+
+// Mul multiplies point A by scalar s in constant time, or the generator if
+// A is nil.
+func (P *ristrettoPoint) Mul(s kyber.Scalar, A kyber.Point) kyber.Point {
+	a := &s.(*scalar).v
+
+	if A == nil {
+		geScalarMultBase(&P.ge, a)
+	} else {
+		geScalarMult(&P.ge, a, &A.(*ristrettoPoint).ge)
+	}
+	return P
+}
+
+// RistrettoToBytes sets s to the canonical Ristretto255 encoding of the
+// class of p.
+func (p *extendedGroupElement) RistrettoToBytes(s *[32]byte) {
+	var u1, u2, t, invSqrt, den1, den2, zInv, x, y, ix, iy, denInv fieldElement
+
+	feAdd(&u1, &p.Z, &p.Y)
+	feSub(&t, &p.Z, &p.Y)
+	feMul(&u1, &u1, &t) // (z+y)(z-y)
+	feMul(&u2, &p.X, &p.Y)
+
+	feSquare(&t, &u2)
+	feMul(&t, &t, &u1)
+	var one fieldElement
+	feOne(&one)
+	feSqrtRatioM1(&invSqrt, &one, &t) // 1/sqrt(u1*u2^2)
+	feMul(&den1, &invSqrt, &u1)
+	feMul(&den2, &invSqrt, &u2)
+	feMul(&zInv, &den1, &den2)
+	feMul(&zInv, &zInv, &p.T)
+
+	// Rotate to the coset representative with a non-negative t/z
+	feMul(&ix, &p.X, &sqrtM1)
+	feMul(&iy, &p.Y, &sqrtM1)
+	feMul(&t, &p.T, &zInv)
+	rotate := int32(feIsNegative(&t))
+	feCopy(&x, &p.X)
+	feCopy(&y, &p.Y)
+	feCopy(&denInv, &den2)
+	feCMove(&x, &iy, rotate)
+	feCMove(&y, &ix, rotate)
+	feMul(&t, &den1, &invSqrtAMinusD)
+	feCMove(&denInv, &t, rotate)
+
+	feMul(&t, &x, &zInv)
+	feNeg(&ix, &y)
+	feCMove(&y, &ix, int32(feIsNegative(&t)))
+
+	feSub(&t, &p.Z, &y)
+	feMul(&t, &t, &denInv)
+	feAbs(&t, &t)
+	feToBytes(s, &t)
+}
+
+// RistrettoFromBytes sets p to a point of the class encoded by s, and
+// returns false, leaving p in an unspecified state, if s is not the
+// canonical encoding of a group element.
+func (p *extendedGroupElement) RistrettoFromBytes(s []byte) bool {
+	var f, ss, u1, u2, u2Sq, v, t, invSqrt, denX, denY, one fieldElement
+	var check [32]byte
+
+	if len(s) != 32 {
+		return false
+	}
+	feFromBytes(&f, s)
+	feToBytes(&check, &f)
+	if subtle.ConstantTimeCompare(check[:], s) == 0 || s[0]&1 == 1 {
+		return false // non-canonical or negative
+	}
+
+	feOne(&one)
+	feSquare(&ss, &f)
+	feSub(&u1, &one, &ss) // 1 + a*s^2
+	feAdd(&u2, &one, &ss) // 1 - a*s^2
+	feSquare(&u2Sq, &u2)
+
+	// v = a*d*u1^2 - u2^2
+	feSquare(&v, &u1)
+	feMul(&v, &v, &d)
+	feNeg(&v, &v)
+	feSub(&v, &v, &u2Sq)
+
+	feMul(&t, &v, &u2Sq)
+	wasSquare := feSqrtRatioM1(&invSqrt, &one, &t)
+	feMul(&denX, &invSqrt, &u2)
+	feMul(&denY, &invSqrt, &denX)
+	feMul(&denY, &denY, &v)
+
+	feAdd(&p.X, &f, &f)
+	feMul(&p.X, &p.X, &denX)
+	feAbs(&p.X, &p.X) // |2s/u2|
+	feMul(&p.Y, &u1, &denY)
+	feOne(&p.Z)
+	feMul(&p.T, &p.X, &p.Y)
+
+	return wasSquare&(1^int32(feIsNegative(&p.T)))&feIsNonZero(&p.Y) == 1
+}
+
+// RistrettoElligator sets p to a point of the class that the Elligator 2
+// based map of Ristretto255 assigns to the field element t.
+func (p *extendedGroupElement) RistrettoElligator(t *fieldElement) {
+	var r, u, v, s, sPrime, c, n, w0, w1, w2, w3, one, tmp fieldElement
+
+	feOne(&one)
+	feSquare(&r, t)
+	feMul(&r, &r, &sqrtM1) // r = i*t^2
+	feAdd(&u, &r, &one)
+	feMul(&u, &u, &oneMinusDSq) // u = (r+1)(1-d^2)
+
+	// v = (-1 - r*d)(r + d)
+	feMul(&tmp, &r, &d)
+	feAdd(&tmp, &tmp, &one)
+	feNeg(&tmp, &tmp)
+	feAdd(&v, &r, &d)
+	feMul(&v, &v, &tmp)
+
+	wasSquare := feSqrtRatioM1(&s, &u, &v)
+	feMul(&sPrime, &s, t)
+	feAbs(&sPrime, &sPrime)
+	feNeg(&sPrime, &sPrime)
+	feCMove(&s, &sPrime, 1^wasSquare)
+	feNeg(&c, &one)
+	feCMove(&c, &r, 1^wasSquare)
+
+	// n = c(r-1)(d-1)^2 - v
+	feSub(&n, &r, &one)
+	feMul(&n, &n, &c)
+	feMul(&n, &n, &dMinusOneSq)
+	feSub(&n, &n, &v)
+
+	feAdd(&w0, &s, &s)
+	feMul(&w0, &w0, &v)
+	feMul(&w1, &n, &sqrtADMinusOne)
+	feSquare(&tmp, &s)
+	feSub(&w2, &one, &tmp)
+	feAdd(&w3, &one, &tmp)
+
+	feMul(&p.X, &w0, &w3)
+	feMul(&p.Y, &w2, &w1)
+	feMul(&p.Z, &w1, &w3)
+	feMul(&p.T, &w0, &w2)
+}
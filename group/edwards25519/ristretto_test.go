@@ -0,0 +1,134 @@
+package edwards25519
+
+import (
+	"encoding/hex"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3/util/test"
+)
+
+func TestRistretto255(t *testing.T) { test.GroupTest(t, new(Ristretto255)) }
+
+// Test vectors from RFC 9496, appendix A.
+func TestRistretto255_Multiples(t *testing.T) {
+	multiples := []string{
+		"0000000000000000000000000000000000000000000000000000000000000000",
+		"e2f2ae0a6abc4e71a884a961c500515f58e30b6aa582dd8db6a65945e08d2d76",
+		"6a493210f7499cd17fecb510ae0cea23a110e8d5b901f8acadd3095c73a3b919",
+		"94741f5d5d52755ece4f23f044ee27d5d1ea1e2bd196b462166b16152a9d0259",
+		"da80862773358b466ffadfe0b3293ab3d9fd53c5ea6c955358f568322daf6a57",
+		"e882b131016b52c1d3337080187cf768423efccbb517bb495ab812c4160ff44e",
+		"f64746d3c92b13050ed8d80236a7f0007c3b3f962f5ba793d19a601ebb1df403",
+		"44f53520926ec81fbd5a387845beb7df85a96a24ece18738bdcfa6a7822a176d",
+		"903293d8f2287ebe10e2374dc1a53e0bc887e592699f02d077d5263cdd55601c",
+		"02622ace8f7303a31cafc63f8fc48fdc16e1c8c8d234b2f0d6685282a9076031",
+		"20706fd788b2720a1ed2a5dad4952b01f413bcf0e7564de8cdc816689e2db95f",
+		"bce83f8ba5dd2fa572864c24ba1810f9522bc6004afe95877ac73241cafdab42",
+		"e4549ee16b9aa03099ca208c67adafcafa4c3f3e4e5303de6026e3ca8ff84460",
+		"aa52e000df2e16f55fb1032fc33bc42742dad6bd5a8fc0be0167436c5948501f",
+		"46376b80f409b29dc2b5f6f0c52591990896e5716f41477cd30085ab7f10301e",
+		"e0c418f7c8d9c4cdd7395b93ea124f3ad99021bb681dfc3302a9d99a2e53e64e",
+	}
+	g := new(Ristretto255)
+	base := g.Point().Base()
+	p := g.Point().Null()
+	for i, enc := range multiples {
+		require.Equal(t, enc, p.String(), "multiple %d", i)
+		require.True(t, g.Point().Mul(g.Scalar().SetInt64(int64(i)), nil).Equal(p))
+
+		b, _ := hex.DecodeString(enc)
+		q := g.Point()
+		require.NoError(t, q.UnmarshalBinary(b))
+		require.True(t, q.Equal(p))
+		p.Add(p, base)
+	}
+}
+
+func TestRistretto255_BadEncodings(t *testing.T) {
+	bad := []string{
+		// Non-canonical field encodings
+		"00ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+		"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+		"f3ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+		"edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+		// Negative field elements
+		"0100000000000000000000000000000000000000000000000000000000000000",
+		"01ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+		"ed57ffd8c914fb201471d1c3d245ce3c746fcbe63a3679d51b6a516ebebe0e20",
+		// Non-square x^2
+		"26948d35ca62e643e26a83177332e6b6afeb9d08e4268b650f1f5bbd8d81d371",
+		"4eac077a713c57b4f4397629a4145982c661f48044dd3f96427d40b147d9742f",
+		// Negative x*y value
+		"3eb858e78f5a7254d8c9731174a94f76755fd3941c0ac93735c07ba14579630e",
+		"a45fdc55c76448c049a1ab33f17023edfb2be3581e9c7aade8a6125215e04220",
+		// s = -1, which causes y = 0
+		"ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+	}
+	g := new(Ristretto255)
+	for _, enc := range bad {
+		b, _ := hex.DecodeString(enc)
+		require.Error(t, g.Point().UnmarshalBinary(b), enc)
+	}
+	require.Error(t, g.Point().UnmarshalBinary(make([]byte, 31)))
+}
+
+func TestRistretto255_Hash(t *testing.T) {
+	vectors := []struct{ msg, enc string }{
+		{"Ristretto is traditionally a short shot of espresso coffee",
+			"3066f82a1a747d45120d1740f14358531a8f04bbffe6a819f86dfe50f44a0a46"},
+		{"but most of those that outside of Italy call it espresso ristretto are actually a little longer than a traditional espresso",
+			"205612afcf4bc812ac0ce60fbdb9512e7123772821944afbb9511560045a673c"},
+	}
+	g := new(Ristretto255)
+	for _, v := range vectors {
+		p := g.Point().(*ristrettoPoint).Hash([]byte(v.msg))
+		require.Equal(t, v.enc, p.String())
+	}
+}
+
+func TestRistretto255_Cosets(t *testing.T) {
+	// Adding a point of small order does not change the element
+	g := new(Ristretto255)
+	p := g.Point().Pick(tSuite.RandomStream()).(*ristrettoPoint)
+	var torsion, q extendedGroupElement // (0,-1), of order 2
+	feZero(&torsion.X)
+	feOne(&torsion.Y)
+	feNeg(&torsion.Y, &torsion.Y)
+	feOne(&torsion.Z)
+	feZero(&torsion.T)
+
+	var c cachedGroupElement
+	var r completedGroupElement
+	torsion.ToCached(&c)
+	r.Add(&p.ge, &c)
+	r.ToExtended(&q)
+	require.True(t, p.Equal(&ristrettoPoint{ge: q}))
+	require.Equal(t, p.String(), (&ristrettoPoint{ge: q}).String())
+}
+
+func BenchmarkRistretto255Encode(b *testing.B) {
+	p := new(Ristretto255).Point().Pick(tSuite.RandomStream())
+	buf := make([]byte, 0, 32)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, _ = p.(*ristrettoPoint).AppendBinary(buf)
+	}
+}
+
+func BenchmarkRistretto255Decode(b *testing.B) {
+	p := new(Ristretto255).Point().Pick(tSuite.RandomStream())
+	enc, _ := p.MarshalBinary()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = p.UnmarshalBinary(enc)
+	}
+}
+
+func BenchmarkRistretto255Hash(b *testing.B) {
+	p := new(Ristretto255).Point().(*ristrettoPoint)
+	msg := []byte("hello world")
+	for i := 0; i < b.N; i++ {
+		p.Hash(msg)
+	}
+}
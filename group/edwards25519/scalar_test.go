@@ -2,11 +2,14 @@ package edwards25519
 
 import (
 	"fmt"
+	"math"
+	"math/big"
 	"testing"
 
 	"github.com/stretchr/testify/require"
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/util/random"
+	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
 
 // SimpleCTScalar implements the scalar operations only using `ScMulAdd` by
@@ -122,6 +125,109 @@ func TestSetBytesLE(t *testing.T) {
 	}
 }
 
+func TestScalar_InvWindows(t *testing.T) {
+	e := big.NewInt(1)
+	for _, w := range scInvWindows {
+		e.Lsh(e, uint(w.squarings))
+		e.Add(e, big.NewInt(int64(w.power)))
+	}
+	require.Equal(t, lMinus2.String(), e.String())
+}
+
+func TestScalar_Inv(t *testing.T) {
+	one := tSuite.Scalar().One()
+	for i := 0; i < 100; i++ {
+		s := tSuite.Scalar().Pick(random.New())
+		inv := tSuite.Scalar().Inv(s)
+		require.True(t, one.Equal(tSuite.Scalar().Mul(s, inv)))
+	}
+	require.True(t, one.Equal(tSuite.Scalar().Inv(one)))
+}
+
+// scBig returns the scalar encoding a as a little-endian integer.
+func scBig(a *[32]byte) *big.Int {
+	var be [32]byte
+	for i := range a {
+		be[i] = a[31-i]
+	}
+	return new(big.Int).SetBytes(be[:])
+}
+
+// scBytes returns the 32-byte little-endian encoding of v < 2^256.
+func scBytes(v *big.Int) [32]byte {
+	var a [32]byte
+	b := v.Bytes()
+	for i := range b {
+		a[i] = b[len(b)-1-i]
+	}
+	return a
+}
+
+func TestScalar_Arithmetic(t *testing.T) {
+	// Edge values, including non-canonical ones up to 2^256-1
+	var edges [][32]byte
+	for _, v := range []*big.Int{
+		big.NewInt(0),
+		big.NewInt(1),
+		new(big.Int).Sub(primeOrder, big.NewInt(1)),
+		primeOrder,
+		new(big.Int).Lsh(big.NewInt(1), 252),
+		new(big.Int).Sub(new(big.Int).Lsh(big.NewInt(1), 255), big.NewInt(1)),
+		new(big.Int).Sub(new(big.Int).Lsh(big.NewInt(1), 256), big.NewInt(1)),
+	} {
+		edges = append(edges, scBytes(v))
+	}
+	rand := random.New()
+	for i := 0; i < 50; i++ {
+		var b [32]byte
+		random.Bytes(b[:], rand)
+		edges = append(edges, b)
+	}
+
+	l := primeOrder
+	for _, a := range edges {
+		for _, b := range edges {
+			a, b := a, b
+			x, y := scBig(&a), scBig(&b)
+			var r [32]byte
+
+			scAdd(&r, &a, &b)
+			require.Equal(t, new(big.Int).Mod(new(big.Int).Add(x, y), l).String(), scBig(&r).String())
+			scSub(&r, &a, &b)
+			require.Equal(t, new(big.Int).Mod(new(big.Int).Sub(x, y), l).String(), scBig(&r).String())
+			scMul(&r, &a, &b)
+			require.Equal(t, new(big.Int).Mod(new(big.Int).Mul(x, y), l).String(), scBig(&r).String())
+			scMulAdd(&r, &a, &b, &a)
+			exp := new(big.Int).Add(new(big.Int).Mul(x, y), x)
+			require.Equal(t, exp.Mod(exp, l).String(), scBig(&r).String())
+
+			var wide [64]byte
+			copy(wide[:32], a[:])
+			copy(wide[32:], b[:])
+			scReduce(&r, &wide)
+			exp = new(big.Int).Add(new(big.Int).Lsh(y, 256), x)
+			require.Equal(t, exp.Mod(exp, l).String(), scBig(&r).String())
+		}
+
+		x := new(big.Int).Mod(scBig(&a), l)
+		s := &scalar{v: a}
+		if x.Sign() != 0 {
+			s.Inv(s)
+			require.Equal(t, new(big.Int).ModInverse(x, l).String(), scBig(&s.v).String())
+		}
+
+		s.v = a
+		exp := scBytes(x)
+		buf, err := s.MarshalBinary()
+		require.NoError(t, err)
+		require.Equal(t, exp[:], buf)
+
+		s.SetBytes(append(a[:], a[:]...))
+		y := new(big.Int).Add(new(big.Int).Lsh(scBig(&a), 256), scBig(&a))
+		require.Equal(t, y.Mod(y, l).String(), scBig(&s.v).String())
+	}
+}
+
 func testSimple(t *testing.T, new func() kyber.Scalar) {
 	s1 := new()
 	s2 := new()
@@ -457,3 +563,21 @@ func scSubFact(s, a, c *[32]byte) {
 
 	scReduceLimbs(limbs)
 }
+
+func TestScalar_SetInt64(t *testing.T) {
+	for _, v := range []int64{0, 1, -1, 0x100, -0x100, math.MaxInt64, math.MinInt64} {
+		s := new(scalar).SetInt64(v).(*scalar)
+		exp := new(big.Int).Mod(big.NewInt(v), primeOrder)
+		require.Equal(t, exp.String(), scBig(&s.v).String())
+	}
+}
+
+func TestScalar_Pick(t *testing.T) {
+	// Pick must keep drawing the same scalars as the generic sampler
+	seed := []byte("edwards25519 scalar pick")
+	for i := 0; i < 100; i++ {
+		s := new(scalar).Pick(blake2xb.New(append(seed, byte(i))))
+		exp := random.Int(primeOrder, blake2xb.New(append(seed, byte(i))))
+		require.Equal(t, exp.String(), scBig(&s.(*scalar).v).String())
+	}
+}
@@ -6,20 +6,50 @@ import (
 	"crypto/cipher"
 	"io"
 	"reflect"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 )
 
-// PointMarshalTo provides a generic implementation of Point.EncodeTo
-// based on Point.Encode.
-func PointMarshalTo(p kyber.Point, w io.Writer) (int, error) {
-	buf, err := p.MarshalBinary()
+// SliceForAppend extends buf by n bytes, reallocating it only if its capacity
+// is too small, and returns the extended slice along with its last n bytes.
+func SliceForAppend(buf []byte, n int) (ret, tail []byte) {
+	if total := len(buf) + n; cap(buf) >= total {
+		ret = buf[:total]
+	} else {
+		ret = make([]byte, total)
+		copy(ret, buf)
+	}
+	tail = ret[len(buf):]
+	return
+}
+
+// writeBuffers holds scratch buffers for marshalTo. Writers must not retain
+// the slices they are given, so the buffers can be reused right away.
+var writeBuffers = sync.Pool{
+	New: func() interface{} { return new([]byte) },
+}
+
+// marshalTo writes the encoding of m to w through a pooled buffer, so that
+// it does not allocate for objects implementing kyber.BinaryAppender.
+func marshalTo(m kyber.Marshaling, w io.Writer) (int, error) {
+	bp := writeBuffers.Get().(*[]byte)
+	defer writeBuffers.Put(bp)
+
+	buf, err := kyber.AppendBinary((*bp)[:0], m)
+	*bp = buf[:0]
 	if err != nil {
 		return 0, err
 	}
 	return w.Write(buf)
 }
 
+// PointMarshalTo provides a generic implementation of Point.EncodeTo
+// based on Point.Encode.
+func PointMarshalTo(p kyber.Point, w io.Writer) (int, error) {
+	return marshalTo(p, w)
+}
+
 // PointUnmarshalFrom provides a generic implementation of Point.DecodeFrom,
 // based on Point.Decode, or Point.Pick if r is a Cipher or cipher.Stream.
 // The returned byte-count is valid only when decoding from a normal Reader,
@@ -40,11 +70,7 @@ func PointUnmarshalFrom(p kyber.Point, r io.Reader) (int, error) {
 // ScalarMarshalTo provides a generic implementation of Scalar.EncodeTo
 // based on Scalar.Encode.
 func ScalarMarshalTo(s kyber.Scalar, w io.Writer) (int, error) {
-	buf, err := s.MarshalBinary()
-	if err != nil {
-		return 0, err
-	}
-	return w.Write(buf)
+	return marshalTo(s, w)
 }
 
 // ScalarUnmarshalFrom provides a generic implementation of Scalar.DecodeFrom,
@@ -8,6 +8,7 @@ import (
 	"errors"
 	"io"
 	"math/big"
+	"math/bits"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
@@ -313,20 +314,31 @@ func (i *Int) MarshalSize() int {
 // MarshalBinary encodes the value of this Int into a byte-slice exactly Len() bytes long.
 // It uses i's ByteOrder to determine which byte order to output.
 func (i *Int) MarshalBinary() ([]byte, error) {
-	l := i.MarshalSize()
-	b := i.V.Bytes() // may be shorter than l
-	offset := l - len(b)
+	return i.AppendBinary(make([]byte, 0, i.MarshalSize()))
+}
 
-	if i.BO == LittleEndian {
-		return i.LittleEndian(l, l), nil
+// AppendBinary appends the encoding of MarshalBinary to buf, reading the
+// words of the value directly instead of going through a temporary slice.
+func (i *Int) AppendBinary(buf []byte) ([]byte, error) {
+	l := i.MarshalSize()
+	ret, b := marshalling.SliceForAppend(buf, l)
+
+	// Write the value little-endian first, padded with zeros
+	k := 0
+	for _, w := range i.V.Bits() {
+		for j := 0; j < bits.UintSize/8 && k < l; j++ {
+			b[k] = byte(w >> uint(8*j))
+			k++
+		}
+	}
+	for ; k < l; k++ {
+		b[k] = 0
 	}
 
-	if offset != 0 {
-		nb := make([]byte, l)
-		copy(nb[offset:], b)
-		b = nb
+	if i.BO == BigEndian {
+		reverse(b, b)
 	}
-	return b, nil
+	return ret, nil
 }
 
 // MarshalID returns a unique identifier for this type
@@ -169,6 +169,52 @@ func (p *curvePoint) Mul(s kyber.Scalar, b kyber.Point) kyber.Point {
 	return p
 }
 
+// combinedMult is implemented by curves of Go's crypto/elliptic package,
+// such as P-256, that compute baseScalar*G + scalar*(x, y) in a single pass.
+type combinedMult interface {
+	CombinedMult(x, y *big.Int, baseScalar, scalar []byte) (*big.Int, *big.Int)
+}
+
+// MultiScalarMul sets p to the sum of scalars[i]*points[i] and returns p,
+// where a nil entry in points stands for the base point. All base point terms
+// are collapsed into a single multiplication, which is interleaved with one
+// of the other terms if the underlying curve supports it. It must only be
+// used on public Scalars and Points.
+func (p *curvePoint) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("nist: mismatched number of scalars and points")
+	}
+
+	// Sum up the coefficients of the base point
+	base := p.c.Scalar().Zero()
+	others := make([]int, 0, len(points))
+	for i := range points {
+		if points[i] == nil {
+			base.Add(base, scalars[i])
+		} else if cp := points[i].(*curvePoint); cp.x.Sign() != 0 || cp.y.Sign() != 0 {
+			others = append(others, i)
+		}
+	}
+
+	x, y := new(big.Int), new(big.Int)
+	if cm, ok := p.c.Curve.(combinedMult); ok && len(others) > 0 {
+		cp := points[others[0]].(*curvePoint)
+		x, y = cm.CombinedMult(cp.x, cp.y, base.(*mod.Int).V.Bytes(),
+			scalars[others[0]].(*mod.Int).V.Bytes())
+		others = others[1:]
+	} else if !base.Equal(p.c.Scalar().Zero()) {
+		x, y = p.c.ScalarBaseMult(base.(*mod.Int).V.Bytes())
+	}
+	for _, i := range others {
+		cp := points[i].(*curvePoint)
+		tx, ty := p.c.ScalarMult(cp.x, cp.y, scalars[i].(*mod.Int).V.Bytes())
+		x, y = p.c.Add(x, y, tx, ty)
+	}
+
+	p.x, p.y = x, y
+	return p
+}
+
 func (p *curvePoint) MarshalSize() int {
 	coordlen := (p.c.Params().BitSize + 7) >> 3
 	return 1 + 2*coordlen // uncompressed ANSI X9.62 representation
@@ -49,3 +49,9 @@ func (s *SuiteBn256) ScalarLen() int {
 func (s *SuiteBn256) String() string {
 	return "bn256.adapter"
 }
+
+// MultiPair returns the product of the pairings of the points p1[i] in G1
+// and p2[i] in G2.
+func (s *SuiteBn256) MultiPair(p1, p2 []kyber.Point) kyber.Point {
+	return MultiPair(s.Suite, p1, p2)
+}
@@ -4,6 +4,7 @@ import (
 	"testing"
 
 	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/util/key"
 )
 
@@ -26,3 +27,18 @@ func TestAdapter_SuiteBn256(t *testing.T) {
 
 	require.Equal(t, "bn256.adapter", suite.String())
 }
+
+func TestAdapter_PairingCheck(t *testing.T) {
+	suite := NewSuiteBn256()
+	a := suite.Scalar().Pick(suite.RandomStream())
+	p := suite.G1().Point().Pick(suite.RandomStream())
+	q := suite.G2().Point().Pick(suite.RandomStream())
+	ap := suite.G1().Point().Mul(a, p)
+	aq := suite.G2().Point().Mul(a, q)
+
+	// e(aP, Q) == e(P, aQ)
+	require.True(t, PairingCheck(suite, []kyber.Point{ap, suite.G1().Point().Neg(p)},
+		[]kyber.Point{q, aq}))
+	require.False(t, PairingCheck(suite, []kyber.Point{ap, p}, []kyber.Point{q, aq}))
+	require.True(t, MultiPair(suite, []kyber.Point{ap}, []kyber.Point{q}).Equal(suite.Pair(p, aq)))
+}
@@ -0,0 +1,259 @@
+package bn256
+
+import (
+	"errors"
+)
+
+// The compressed encodings of points of G1 and G2 keep x and the sign of y.
+// As p is larger than 2²⁵⁵, x has no spare bit for the sign, so they start
+// with a byte in the style of SEC 1: 0 for the point at infinity, followed by
+// zeros, and 2 or 3 for a point whose y is even or odd. The sign of an element
+// xi+y of GF(p²) is that of y, or of x if y is zero. Decoding rejects
+// coordinates that are not reduced modulo p, and the odd flag when y is zero,
+// so that every point has exactly one encoding.
+const (
+	compressedInfinity = 0
+	compressedEven     = 2
+	compressedOdd      = 3
+)
+
+func (p *pointG1) appendCompressed(buf []byte) ([]byte, error) {
+	n := p.ElementSize()
+	pgtemp := *p.g
+	pgtemp.MakeAffine()
+	buf, ret := sliceForAppend(buf, 1+n)
+	if pgtemp.IsInfinity() {
+		for i := range ret {
+			ret[i] = 0
+		}
+		return buf, nil
+	}
+
+	x, y := &gfP{}, &gfP{}
+	montDecode(x, &pgtemp.x)
+	montDecode(y, &pgtemp.y)
+	ret[0] = compressedEven | byte(y[0]&1)
+	x.Marshal(ret[1:])
+	return buf, nil
+}
+
+func (p *pointG1) unmarshalCompressed(buf []byte) error {
+	n := p.ElementSize()
+	if len(buf) < 1+n {
+		return errors.New("bn256.G1: not enough data")
+	}
+	if p.g == nil {
+		p.g = &curvePoint{}
+	}
+
+	switch buf[0] {
+	case compressedInfinity:
+		if !allZero(buf[1 : 1+n]) {
+			return errors.New("bn256.G1: malformed point")
+		}
+		p.g.SetInfinity()
+		return nil
+	case compressedEven, compressedOdd:
+	default:
+		return errors.New("bn256.G1: malformed point")
+	}
+
+	// y² = x³+3
+	if !isReduced(buf[1:]) {
+		return errors.New("bn256.G1: malformed point")
+	}
+	x, y, y2 := &gfP{}, &gfP{}, &gfP{}
+	x.Unmarshal(buf[1:])
+	montEncode(x, x)
+	gfpMul(y2, x, x)
+	gfpMul(y2, y2, x)
+	gfpAdd(y2, y2, curveB)
+	if !y.Sqrt(y2) {
+		return errors.New("bn256.G1: malformed point")
+	}
+	if *y == (gfP{}) && buf[0] == compressedOdd {
+		return errors.New("bn256.G1: malformed point")
+	}
+	t := &gfP{}
+	montDecode(t, y)
+	if byte(t[0]&1) != buf[0]&1 {
+		gfpNeg(y, y)
+	}
+
+	p.g.x, p.g.y = *x, *y
+	p.g.z = *newGFp(1)
+	p.g.t = *newGFp(1)
+	return nil
+}
+
+func (p *pointG2) appendCompressed(buf []byte) ([]byte, error) {
+	n := p.ElementSize()
+
+	// Take a copy as making the point affine changes it
+	var g twistPoint
+	if p.g != nil {
+		g = *p.g
+	}
+	g.MakeAffine()
+
+	buf, ret := sliceForAppend(buf, 1+2*n)
+	if g.IsInfinity() {
+		for i := range ret {
+			ret[i] = 0
+		}
+		return buf, nil
+	}
+
+	ret[0] = compressedEven | gfP2Sign(&g.y)
+	temp := &gfP{}
+	montDecode(temp, &g.x.x)
+	temp.Marshal(ret[1:])
+	montDecode(temp, &g.x.y)
+	temp.Marshal(ret[1+n:])
+	return buf, nil
+}
+
+func (p *pointG2) unmarshalCompressed(buf []byte) error {
+	n := p.ElementSize()
+	if len(buf) < 1+2*n {
+		return errors.New("bn256.G2: not enough data")
+	}
+	if p.g == nil {
+		p.g = &twistPoint{}
+	}
+
+	switch buf[0] {
+	case compressedInfinity:
+		if !allZero(buf[1 : 1+2*n]) {
+			return errors.New("bn256.G2: malformed point")
+		}
+		p.g.SetInfinity()
+		return nil
+	case compressedEven, compressedOdd:
+	default:
+		return errors.New("bn256.G2: malformed point")
+	}
+
+	// y² = x³+3/ξ
+	if !isReduced(buf[1:]) || !isReduced(buf[1+n:]) {
+		return errors.New("bn256.G2: malformed point")
+	}
+	x, y2 := &gfP2{}, &gfP2{}
+	x.x.Unmarshal(buf[1:])
+	x.y.Unmarshal(buf[1+n:])
+	montEncode(&x.x, &x.x)
+	montEncode(&x.y, &x.y)
+	y2.Square(x).Mul(y2, x).Add(y2, twistB)
+
+	y := &gfP2{}
+	if !y.Sqrt(y2) {
+		return errors.New("bn256.G2: malformed point")
+	}
+	if y.IsZero() && buf[0] == compressedOdd {
+		return errors.New("bn256.G2: malformed point")
+	}
+	if gfP2Sign(y) != buf[0]&1 {
+		y.Neg(y)
+	}
+
+	p.g.x.Set(x)
+	p.g.y.Set(y)
+	p.g.z.SetOne()
+	p.g.t.SetOne()
+	if !p.g.IsInG2() {
+		return errors.New("bn256.G2: point is not in G2")
+	}
+	return nil
+}
+
+// gfP2Sign returns the parity of y in the element xi+y, or of x if y is zero.
+func gfP2Sign(e *gfP2) byte {
+	t := &gfP{}
+	montDecode(t, &e.y)
+	if *t == (gfP{}) {
+		montDecode(t, &e.x)
+	}
+	return byte(t[0] & 1)
+}
+
+// The compressed encoding of GT maps an element a = xω+y, whose norm
+// y²-τx² over GF(p⁶) is one, to c = (1+y)/x in GF(p⁶), which is the torus-based
+// compression of Rubin and Silverberg, "Torus-based cryptography", CRYPTO
+// 2003. The inverse map is a = (c+ω)/(c-ω). Of the two elements where x is
+// zero, ±1, only the identity is in GT, and it is encoded as c = 0, which the
+// map never yields.
+
+func (p *pointGT) appendCompressed(buf []byte) ([]byte, error) {
+	n := p.ElementSize()
+	buf, ret := sliceForAppend(buf, 6*n)
+
+	c := &gfP6{}
+	if !p.g.x.IsZero() {
+		t := (&gfP6{}).SetOne()
+		t.Add(t, &p.g.y)
+		c.Invert(&p.g.x).Mul(c, t)
+	}
+
+	temp := &gfP{}
+	for i, e := range []*gfP{&c.x.x, &c.x.y, &c.y.x, &c.y.y, &c.z.x, &c.z.y} {
+		montDecode(temp, e)
+		temp.Marshal(ret[i*n:])
+	}
+	return buf, nil
+}
+
+func (p *pointGT) unmarshalCompressed(buf []byte) error {
+	n := p.ElementSize()
+	if len(buf) < 6*n {
+		return errors.New("bn256.GT: not enough data")
+	}
+	if p.g == nil {
+		p.g = &gfP12{}
+	}
+
+	c := &gfP6{}
+	for i, e := range []*gfP{&c.x.x, &c.x.y, &c.y.x, &c.y.y, &c.z.x, &c.z.y} {
+		if !isReduced(buf[i*n:]) {
+			return errors.New("bn256.GT: malformed element")
+		}
+		e.Unmarshal(buf[i*n:])
+		montEncode(e, e)
+	}
+	if c.IsZero() {
+		p.g.SetOne()
+		return nil
+	}
+
+	// (c+ω)/(c-ω) = (c²+τ + 2cω)/(c²-τ), where c²-τ is not zero as τ is not a
+	// square in GF(p⁶)
+	c2 := (&gfP6{}).Square(c)
+	tau := &gfP6{}
+	tau.y.SetOne()
+	den := (&gfP6{}).Sub(c2, tau)
+	den.Invert(den)
+
+	p.g.y.Add(c2, tau).Mul(&p.g.y, den)
+	p.g.x.Add(c, c).Mul(&p.g.x, den)
+	return nil
+}
+
+// isReduced reports whether the first 32 bytes of buf encode, in big-endian
+// order, an integer below p, so that every element has a single encoding.
+func isReduced(buf []byte) bool {
+	e := &gfP{}
+	e.Unmarshal(buf)
+	for i := len(e) - 1; i >= 0; i-- {
+		if e[i] != p2[i] {
+			return e[i] < p2[i]
+		}
+	}
+	return false
+}
+
+func allZero(buf []byte) bool {
+	var acc byte
+	for _, b := range buf {
+		acc |= b
+	}
+	return acc == 0
+}
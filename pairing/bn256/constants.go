@@ -12,6 +12,9 @@ func bigFromBase10(s string) *big.Int {
 // u is the BN parameter that determines the prime: 1868033³.
 var u = bigFromBase10("6518589491078791937")
 
+// sixuSquared is 6u², the difference between p and Order.
+var sixuSquared = bigFromBase10("254952053719217181996082057820017271814")
+
 // p is a prime over which we form a basic field: 36u⁴+36u³+24u²+6u+1.
 var p = bigFromBase10("65000549695646603732796438742359905742825358107623003571877145026864184071783")
 
@@ -19,6 +22,43 @@ var p = bigFromBase10("650005496956466037327964387423599057428253581076230035718
 // order-1 = (2**5) * 3 * 5743 * 280941149 * 130979359433191 * 491513138693455212421542731357 * 6518589491078791937
 var Order = bigFromBase10("65000549695646603732796438742359905742570406053903786389881062969044166799969")
 
+// glvLambda is the eigenvalue, 36u⁴-1, of the endomorphism (x,y) ↦ (βx,y) on
+// G₁, where β = xiToPSquaredMinus1Over3 is a cube root of unity in GF(p).
+var glvLambda = bigFromBase10("65000549695646603722824872073741637221039789405711904108462808869275558850595")
+
+// glvBasis is a reduced basis of the lattice of (a,b) with a+b·λ ≡ 0 mod Order:
+// (2u+1, 6u²+4u+1) and (6u²+2u, -2u-1).
+var glvBasis = [2][2]*big.Int{
+	{bigFromBase10("13037178982157583875"), bigFromBase10("254952053719217182022156415784332439563")},
+	{bigFromBase10("254952053719217182009119236802174855688"), bigFromBase10("-13037178982157583875")},
+}
+
+// glvRound holds ⌊2²⁵⁶·(2u+1)/Order⌋ and ⌊2²⁵⁶·(6u²+4u+1)/Order⌋, with which a
+// scalar is split along glvBasis without a division.
+var glvRound = [2]*big.Int{
+	bigFromBase10("23224452703450895968"),
+	bigFromBase10("454172019986314348532132033830160128678"),
+}
+
+// glsBasis is a reduced basis of the lattice of (a,b,c,d) with
+// a+b·p+c·p²+d·p³ ≡ 0 mod Order, used to split scalars of G₂ along the
+// endomorphism ψ, which acts as multiplication by p on G₂.
+var glsBasis = [4][4]*big.Int{
+	{bigFromBase10("13037178982157583874"), bigFromBase10("6518589491078791938"), bigFromBase10("-6518589491078791937"), bigFromBase10("6518589491078791937")},
+	{bigFromBase10("-6518589491078791937"), bigFromBase10("6518589491078791937"), bigFromBase10("-6518589491078791937"), bigFromBase10("-13037178982157583875")},
+	{bigFromBase10("6518589491078791938"), bigFromBase10("6518589491078791937"), bigFromBase10("6518589491078791937"), bigFromBase10("-13037178982157583874")},
+	{bigFromBase10("13037178982157583875"), bigFromBase10("-6518589491078791937"), bigFromBase10("-6518589491078791938"), bigFromBase10("-6518589491078791937")},
+}
+
+// glsRound holds the first row of the inverse of glsBasis, scaled by 2²⁵⁶ and
+// rounded down.
+var glsRound = [4]*big.Int{
+	bigFromBase10("2960560956624815769047210225903935184319436574659579038386"),
+	bigFromBase10("-2960560956624815769501382245890249532839956382138013719080"),
+	bigFromBase10("2960560956624815769501382245890249532863180834841464615047"),
+	bigFromBase10("2960560956624815769501382245890249532828344155786288271096"),
+}
+
 // xiToPMinus1Over6 is ξ^((p-1)/6) where ξ = i+3.
 var xiToPMinus1Over6 = &gfP2{gfP{0x25af52988477cdb7, 0x3d81a455ddced86a, 0x227d012e872c2431, 0x179198d3ea65d05}, gfP{0x7407634dd9cca958, 0x36d5bd6c7afb8f26, 0xf4b1c32cebd880fa, 0x6aa7869306f455f}}
 
@@ -40,9 +80,25 @@ var xiToPSquaredMinus1Over6 = &gfP{0xe21a761d259c78af, 0x6358fa3f5e84f7e, 0xb7c4
 // xiTo2PMinus2Over3 is ξ^((2p-2)/3) where ξ = i+3.
 var xiTo2PMinus2Over3 = &gfP2{gfP{0x51678e7469b3c52a, 0x4fb98f8b13319fc9, 0x29b2254db3f1df75, 0x1c044935a3d22fb2}, gfP{0x4d2ea218872f3d2c, 0x2fcb27fc4abe7b69, 0xd31d972f0e88ced9, 0x53adc04a00a73b15}}
 
+// svdwC2, svdwC3 and svdwC4 are the constants c2 = -Z/2, c3 = sqrt(-g(Z)·3Z²),
+// with sgn0(c3) = 0, and c4 = -4g(Z)/(3Z²) of the Shallue–van de Woestijne map
+// of RFC 9380, section 6.6.1, for g(x) = x³+3 and Z = 1.
+var svdwC2 = &gfP{0x185cac6c5e089667, 0xee5b88d120b5b59e, 0xaa6fecb86184dc21, 0xfb501e34aa387f9}
+var svdwC3 = &gfP{0x46dcceb2ad7cf076, 0xa72afcde6f356c8, 0xcc0f134ed1e94b88, 0x9f12f3bb175aea9}
+var svdwC4 = &gfP{0xa6684b0a7658bcd3, 0x9f073070fcaaff61, 0x8bd9e37145078d5e, 0x77a3be2cadef27be}
+
 // p2 is p, represented as little-endian 64-bit words.
 var p2 = [4]uint64{0x185cac6c5e089667, 0xee5b88d120b5b59e, 0xaa6fecb86184dc21, 0x8fb501e34aa387f9}
 
+// pPlus1Over4 is (p+1)/4, represented as little-endian 64-bit words.
+var pPlus1Over4 = [4]uint64{0x86172b1b1782259a, 0x7b96e234482d6d67, 0x6a9bfb2e18613708, 0x23ed4078d2a8e1fe}
+
+// pMinus3Over4 is (p-3)/4, represented as little-endian 64-bit words.
+var pMinus3Over4 = [4]uint64{0x86172b1b17822599, 0x7b96e234482d6d67, 0x6a9bfb2e18613708, 0x23ed4078d2a8e1fe}
+
+// pMinus1Over2 is (p-1)/2, represented as little-endian 64-bit words.
+var pMinus1Over2 = [4]uint64{0xc2e56362f044b33, 0xf72dc468905adacf, 0xd537f65c30c26e10, 0x47da80f1a551c3fc}
+
 // np is the negative inverse of p, mod 2^256.
 var np = [4]uint64{0x2387f9007f17daa9, 0x734b3343ab8513c8, 0x2524282f48054c12, 0x38997ae661c3ef3c}
 
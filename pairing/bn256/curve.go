@@ -1,6 +1,7 @@
 package bn256
 
 import (
+	"encoding/binary"
 	"fmt"
 	"math/big"
 )
@@ -184,15 +185,207 @@ func (c *curvePoint) Double(a *curvePoint) {
 	gfpSub(&c.y, t2, t)
 }
 
+// Mul sets c to scalar*a. The scalar is split into two halves of at most 128
+// bits with the GLV endomorphism, and both halves are recoded into the same
+// number of odd signed 4-bit digits, so that the sequence of doublings,
+// additions and table lookups does not depend on the scalar. The split and
+// the recoding themselves run on big.Int, like the scalars of this package,
+// and are not constant time.
 func (c *curvePoint) Mul(a *curvePoint, scalar *big.Int) {
-	sum, t := &curvePoint{}, &curvePoint{}
-	sum.SetInfinity()
+	if a.IsInfinity() {
+		c.SetInfinity()
+		return
+	}
+	k1, k2 := glvDecompose(scalar)
+
+	// tables[0] holds ±a,±3a,...,±15a and tables[1] the image of these under
+	// the endomorphism, with the signs of k1 and k2 respectively
+	var tables [2][8]curvePoint
+	neg1, neg2 := uint64(k1.Sign()>>1)&1, uint64(k2.Sign()>>1)&1
+	two := &curvePoint{}
+	tables[0][0].Set(a)
+	two.Neg(a)
+	tables[0][0].cmov(two, neg1)
+	two.Double(&tables[0][0])
+	for j := 1; j < 8; j++ {
+		tables[0][j].Add(&tables[0][j-1], two)
+	}
+	for j := range tables[1] {
+		tables[1][j].endomorphism(&tables[0][j])
+		two.Neg(&tables[1][j])
+		tables[1][j].cmov(two, neg1^neg2)
+	}
+
+	// Even halves are made odd by adding one, which is taken off at the end
+	var digits [2][glvDigits]int8
+	var even [2]uint64
+	for i, k := range []*big.Int{k1, k2} {
+		even[i] = recodeOdd(digits[i][:], k)
+	}
+
+	sum, t, q := &curvePoint{}, &curvePoint{}, &curvePoint{}
+	sum.lookupOdd(&tables[0], digits[0][glvDigits-1])
+	q.lookupOdd(&tables[1], digits[1][glvDigits-1])
+	t.Add(sum, q)
+	sum.Set(t)
+	for i := glvDigits - 2; i >= 0; i-- {
+		for j := 0; j < 4; j++ {
+			t.Double(sum)
+			sum.Set(t)
+		}
+		for k := range tables {
+			q.lookupOdd(&tables[k], digits[k][i])
+			t.Add(sum, q)
+			sum.Set(t)
+		}
+	}
+	for i := range tables {
+		q.Neg(&tables[i][0])
+		t.Add(sum, q)
+		sum.cmov(t, even[i])
+	}
+
+	c.Set(sum)
+}
+
+// glvDigits is the number of signed 4-bit digits of the halves of a scalar.
+const glvDigits = 33
+
+// glvDecompose returns k1 and k2 such that k ≡ k1 + k2·λ mod Order, where λ is
+// the eigenvalue of the endomorphism and |k1|,|k2| < 2¹²⁸. It rounds k along
+// glvBasis with the precomputed fractions glvRound. It runs in variable time.
+func glvDecompose(k *big.Int) (k1, k2 *big.Int) {
+	k = new(big.Int).Mod(k, Order)
+	c1 := new(big.Int).Mul(k, glvRound[0])
+	c1.Rsh(c1, 256)
+	c2 := new(big.Int).Mul(k, glvRound[1])
+	c2.Rsh(c2, 256)
+
+	t := new(big.Int)
+	k1 = new(big.Int).Set(k)
+	k1.Sub(k1, t.Mul(c1, glvBasis[0][0]))
+	k1.Sub(k1, t.Mul(c2, glvBasis[1][0]))
+	k2 = new(big.Int).Mul(c1, glvBasis[0][1])
+	k2.Add(k2, t.Mul(c2, glvBasis[1][1]))
+	k2.Neg(k2)
+	return k1, k2
+}
+
+// recodeOdd writes |k| or |k|+1, whichever is odd, into digits as odd signed
+// 4-bit digits, least-significant first, and returns 1 if it added one. Each
+// digit is read off directly from the bits of the odd value m, since
+// m = 2⁴·(2⌊m/2⁵⌋+1) + (m mod 2⁵ - 2⁴), where the second term is an odd digit
+// and the first an odd number again. |k| must be below 2^(4·len(digits)) and
+// 2¹⁹¹. Reading k takes time that depends on its length.
+func recodeOdd(digits []int8, k *big.Int) uint64 {
+	var buf [24]byte
+	b := new(big.Int).Abs(k).Bytes()
+	copy(buf[len(buf)-len(b):], b)
+	var m [3]uint64
+	for i := range m {
+		m[i] = binary.BigEndian.Uint64(buf[16-8*i:])
+	}
+	even := 1 - m[0]&1
+	m[0] |= even
+
+	for i := range digits {
+		shift := uint(4*i + 1)
+		w := m[shift/64] >> (shift % 64)
+		if shift%64 > 60 && shift/64+1 < uint(len(m)) {
+			w |= m[shift/64+1] << (64 - shift%64)
+		}
+		digits[i] = int8(2*(w&15)+1) - 16
+	}
+	digits[len(digits)-1] += 16
+	return even
+}
+
+// lookupOdd sets c to the multiple d·a of a in table, which holds a,3a,...,15a,
+// for an odd digit d. It reads every entry of the table.
+func (c *curvePoint) lookupOdd(table *[8]curvePoint, d int8) {
+	mask := d >> 7
+	abs := uint64((d ^ mask) - mask)
+	for j := range table {
+		diff := uint64(2*j+1) ^ abs
+		c.cmov(&table[j], (diff-1)>>63)
+	}
+	neg := &curvePoint{}
+	neg.Neg(c)
+	c.cmov(neg, uint64(mask)&1)
+}
+
+// cmov sets c to a if b is 1 and leaves it unchanged if b is 0, in constant
+// time.
+func (c *curvePoint) cmov(a *curvePoint, b uint64) {
+	mask := -b
+	for i := range c.x {
+		c.x[i] ^= (c.x[i] ^ a.x[i]) & mask
+		c.y[i] ^= (c.y[i] ^ a.y[i]) & mask
+		c.z[i] ^= (c.z[i] ^ a.z[i]) & mask
+		c.t[i] ^= (c.t[i] ^ a.t[i]) & mask
+	}
+}
+
+// endomorphism sets c to the image (βx,y) of a, which on G₁ is λ·a.
+func (c *curvePoint) endomorphism(a *curvePoint) {
+	gfpMul(&c.x, &a.x, xiToPSquaredMinus1Over3)
+	c.y.Set(&a.y)
+	c.z.Set(&a.z)
+	c.t.Set(&a.t)
+}
 
-	for i := scalar.BitLen(); i >= 0; i-- {
+// MultiMul sets c to the sum of scalars[i]*a[i]. Every scalar is split into
+// two halves with the GLV endomorphism, and the width-5 NAF expansions of all
+// the halves are processed together from the most-significant digit downward
+// (Straus' method), so that the doublings are shared by all terms. It runs in
+// variable time.
+func (c *curvePoint) MultiMul(a []*curvePoint, scalars []*big.Int) {
+	nafs := make([][]int8, 2*len(a))
+	tables := make([][8]curvePoint, 2*len(a)) // b,3b,5b,...,15b
+	top := 0
+	two := &curvePoint{}
+	for i := range a {
+		k1, k2 := glvDecompose(scalars[i])
+		nafs[2*i] = wnaf(new(big.Int).Abs(k1), 5)
+		nafs[2*i+1] = wnaf(new(big.Int).Abs(k2), 5)
+		for _, naf := range nafs[2*i : 2*i+2] {
+			if len(naf) > top {
+				top = len(naf)
+			}
+		}
+
+		table := &tables[2*i]
+		table[0].Set(a[i])
+		if k1.Sign() < 0 {
+			table[0].Neg(a[i])
+		}
+		two.Double(&table[0])
+		for j := 1; j < 8; j++ {
+			table[j].Add(&table[j-1], two)
+		}
+		for j := range table {
+			tables[2*i+1][j].endomorphism(&table[j])
+			if (k1.Sign() < 0) != (k2.Sign() < 0) {
+				tables[2*i+1][j].Neg(&tables[2*i+1][j])
+			}
+		}
+	}
+
+	sum, t, neg := &curvePoint{}, &curvePoint{}, &curvePoint{}
+	sum.SetInfinity()
+	for k := top - 1; k >= 0; k-- {
 		t.Double(sum)
-		if scalar.Bit(i) != 0 {
-			sum.Add(t, a)
-		} else {
+		sum.Set(t)
+		for i := range nafs {
+			if k >= len(nafs[i]) || nafs[i][k] == 0 {
+				continue
+			}
+			if d := nafs[i][k]; d > 0 {
+				t.Add(sum, &tables[i][d/2])
+			} else {
+				neg.Neg(&tables[i][-d/2])
+				t.Add(sum, neg)
+			}
 			sum.Set(t)
 		}
 	}
@@ -200,6 +393,30 @@ func (c *curvePoint) Mul(a *curvePoint, scalar *big.Int) {
 	c.Set(sum)
 }
 
+// wnaf returns the width-w non-adjacent form of the non-negative integer k,
+// least-significant digit first: every nonzero digit is odd, lies strictly
+// between -2^(w-1) and 2^(w-1), and is followed by at least w-1 zero digits.
+func wnaf(k *big.Int, w uint) []int8 {
+	naf := make([]int8, 0, k.BitLen()+1)
+	t := new(big.Int).Set(k)
+	d := new(big.Int)
+	mask := big.Word(1)<<w - 1
+	for t.Sign() > 0 {
+		var digit int8
+		if t.Bit(0) == 1 {
+			m := int64(t.Bits()[0] & mask)
+			if m >= 1<<(w-1) {
+				m -= 1 << w
+			}
+			digit = int8(m)
+			t.Sub(t, d.SetInt64(m))
+		}
+		naf = append(naf, digit)
+		t.Rsh(t, 1)
+	}
+	return naf
+}
+
 func (c *curvePoint) MakeAffine() {
 	if c.z == *newGFp(1) {
 		return
@@ -49,6 +49,67 @@ func (e *gfP) Invert(f *gfP) {
 	e.Set(sum)
 }
 
+// Sqrt sets e to a square root of f and reports whether f is a square. As
+// p ≡ 3 mod 4, the root is f^((p+1)/4).
+func (e *gfP) Sqrt(f *gfP) bool {
+	return e.sqrt(f) == 1
+}
+
+// sqrt is Sqrt in constant time: it returns 1 if f is a square, after setting
+// e to a root of it, and 0 otherwise, leaving e unchanged.
+func (e *gfP) sqrt(f *gfP) uint64 {
+	root, square := &gfP{}, &gfP{}
+	root.exp(f, pPlus1Over4)
+	gfpMul(square, root, root)
+	isSquare := square.equal(f)
+	e.cmov(root, isSquare)
+	return isSquare
+}
+
+// equal returns 1 if e and f are equal and 0 otherwise, in constant time.
+func (e *gfP) equal(f *gfP) uint64 {
+	var acc uint64
+	for i := range e {
+		acc |= e[i] ^ f[i]
+	}
+	return 1 ^ (acc|-acc)>>63
+}
+
+// cmov sets e to f if b is 1, and leaves it unchanged if b is 0, in constant
+// time.
+func (e *gfP) cmov(f *gfP, b uint64) {
+	mask := -b
+	for i := range e {
+		e[i] ^= (e[i] ^ f[i]) & mask
+	}
+}
+
+// sgn0 returns the parity of e, as RFC 9380, section 4.1, defines it.
+func (e *gfP) sgn0() uint64 {
+	t := &gfP{}
+	montDecode(t, e)
+	return t[0] & 1
+}
+
+// exp sets e to f^bits, where the exponent bits is given as little-endian
+// 64-bit words. It runs in time that depends on bits only.
+func (e *gfP) exp(f *gfP, bits [4]uint64) {
+	sum, power := &gfP{}, &gfP{}
+	sum.Set(newGFp(1))
+	power.Set(f)
+
+	for word := 0; word < 4; word++ {
+		for bit := uint(0); bit < 64; bit++ {
+			if (bits[word]>>bit)&1 == 1 {
+				gfpMul(sum, sum, power)
+			}
+			gfpMul(power, power, power)
+		}
+	}
+
+	e.Set(sum)
+}
+
 func (e *gfP) Marshal(out []byte) {
 	for w := uint(0); w < 4; w++ {
 		for b := uint(0); b < 8; b++ {
@@ -106,6 +106,26 @@ func (e *gfP12) IsOne() bool {
 	return e.x.IsZero() && e.y.IsOne()
 }
 
+// IsInGT reports whether e is in GT, the subgroup of order Order. It first
+// checks that e^(p⁴-p²+1) = 1, which puts e in the cyclotomic subgroup. As
+// p = Order + 6u², e then has e^Order = 1 exactly when e^p = e^(6u²), which
+// takes a Frobenius map and a cyclotomic exponentiation by 129 bits. It runs
+// in variable time.
+func (e *gfP12) IsInGT() bool {
+	if e.IsZero() {
+		return false
+	}
+	a := (&gfP12{}).FrobeniusP4(e)
+	a.Mul(a, e)
+	b := (&gfP12{}).FrobeniusP2(e)
+	if *a != *b {
+		return false
+	}
+	a.Frobenius(e)
+	b.CyclotomicExp(e, sixuSquared)
+	return *a == *b
+}
+
 func (e *gfP12) Conjugate(a *gfP12) *gfP12 {
 	e.x.Neg(&a.x)
 	e.y.Set(&a.y)
@@ -189,6 +209,117 @@ func (e *gfP12) Exp(a *gfP12, power *big.Int) *gfP12 {
 	return e
 }
 
+// CyclotomicExp sets e to a^power for a in the cyclotomic subgroup of
+// GF(p¹²), using cyclotomic squarings and the non-adjacent form of power,
+// where inverses are conjugates. It runs in variable time and is meant for
+// public exponents such as u.
+func (e *gfP12) CyclotomicExp(a *gfP12, power *big.Int) *gfP12 {
+	inv := (&gfP12{}).Conjugate(a)
+	sum := (&gfP12{}).SetOne()
+
+	naf := wnaf(power, 2)
+	for i := len(naf) - 1; i >= 0; i-- {
+		sum.CyclotomicSquare(sum)
+		if naf[i] > 0 {
+			sum.Mul(sum, a)
+		} else if naf[i] < 0 {
+			sum.Mul(sum, inv)
+		}
+	}
+
+	e.Set(sum)
+	return e
+}
+
+// ExpGT sets e to a^power for a in GT, with a fixed sequence of
+// multiplications, squarings and table lookups. The Frobenius map raises
+// elements of GT to the power p, so power is split into four parts of at most
+// 66 bits as the scalars of G₂ are in twistPoint.Mul, with conjugates for the
+// inverses that the signed digits call for. As there, the split runs on
+// big.Int and is not constant time. The result is wrong for a outside GT.
+func (e *gfP12) ExpGT(a *gfP12, power *big.Int) *gfP12 {
+	k := glsDecompose(power)
+	var negs [4]uint64
+	for i := range k {
+		negs[i] = uint64(k[i].Sign()>>1) & 1
+	}
+
+	// tables[i] holds b,b³,...,b¹⁵ for b = a^(±pⁱ), with the sign of k[i]
+	var tables [4][8]gfP12
+	t := &gfP12{}
+	tables[0][0].Set(a)
+	t.Conjugate(a)
+	tables[0][0].cmov(t, negs[0])
+	t.CyclotomicSquare(&tables[0][0])
+	for j := 1; j < 8; j++ {
+		tables[0][j].Mul(&tables[0][j-1], t)
+	}
+	for i := 1; i < len(tables); i++ {
+		for j := range tables[i] {
+			tables[i][j].Frobenius(&tables[i-1][j])
+			t.Conjugate(&tables[i][j])
+			tables[i][j].cmov(t, negs[i-1]^negs[i])
+		}
+	}
+
+	var digits [4][glsDigits]int8
+	var even [4]uint64
+	for i := range k {
+		even[i] = recodeOdd(digits[i][:], k[i])
+	}
+
+	sum, q := &gfP12{}, &gfP12{}
+	sum.lookupOdd(&tables[0], digits[0][glsDigits-1])
+	for k := 1; k < len(tables); k++ {
+		q.lookupOdd(&tables[k], digits[k][glsDigits-1])
+		sum.Mul(sum, q)
+	}
+	for i := glsDigits - 2; i >= 0; i-- {
+		for j := 0; j < 4; j++ {
+			sum.CyclotomicSquare(sum)
+		}
+		for k := range tables {
+			q.lookupOdd(&tables[k], digits[k][i])
+			sum.Mul(sum, q)
+		}
+	}
+	for i := range tables {
+		q.Conjugate(&tables[i][0])
+		t.Mul(sum, q)
+		sum.cmov(t, even[i])
+	}
+
+	e.Set(sum)
+	return e
+}
+
+// lookupOdd sets e to the power a^d of a in table, which holds a,a³,...,a¹⁵,
+// for an odd digit d. It reads every entry of the table.
+func (e *gfP12) lookupOdd(table *[8]gfP12, d int8) {
+	mask := d >> 7
+	abs := uint64((d ^ mask) - mask)
+	for j := range table {
+		diff := uint64(2*j+1) ^ abs
+		e.cmov(&table[j], (diff-1)>>63)
+	}
+	inv := (&gfP12{}).Conjugate(e)
+	e.cmov(inv, uint64(mask)&1)
+}
+
+// cmov sets e to a if b is 1 and leaves it unchanged if b is 0, in constant
+// time.
+func (e *gfP12) cmov(a *gfP12, b uint64) {
+	mask := -b
+	es := [6]*gfP2{&e.x.x, &e.x.y, &e.x.z, &e.y.x, &e.y.y, &e.y.z}
+	as := [6]*gfP2{&a.x.x, &a.x.y, &a.x.z, &a.y.x, &a.y.y, &a.y.z}
+	for j, c := range es {
+		for i := range c.x {
+			c.x[i] ^= (c.x[i] ^ as[j].x[i]) & mask
+			c.y[i] ^= (c.y[i] ^ as[j].y[i]) & mask
+		}
+	}
+}
+
 func (e *gfP12) Square(a *gfP12) *gfP12 {
 	// Complex squaring algorithm
 	v0 := (&gfP6{}).Mul(&a.x, &a.y)
@@ -205,6 +336,48 @@ func (e *gfP12) Square(a *gfP12) *gfP12 {
 	return e
 }
 
+// CyclotomicSquare sets e to a² for a in the cyclotomic subgroup of GF(p¹²),
+// the elements of order dividing p⁴-p²+1, to which GT belongs. It uses the
+// squaring of Granger and Scott, "Faster Squaring in the Cyclotomic Subgroup
+// of Sixth Degree Extensions", http://eprint.iacr.org/2009/565.pdf, section
+// 3.2, which costs nine GF(p²) squarings instead of two GF(p⁶)
+// multiplications.
+func (e *gfP12) CyclotomicSquare(a *gfP12) *gfP12 {
+	// The coefficients pair up into three elements of GF(p⁴) = GF(p²)(σ) with
+	// σ²=ξ, namely a.y.z+a.x.y·σ, a.x.z+a.y.x·σ and a.y.y+a.x.x·σ, which
+	// are squared with three GF(p²) squarings each
+	t0 := (&gfP2{}).Square(&a.x.y)
+	t1 := (&gfP2{}).Square(&a.y.z)
+	t6 := (&gfP2{}).Add(&a.x.y, &a.y.z)
+	t6.Square(t6).Sub(t6, t0).Sub(t6, t1) // 2·a.x.y·a.y.z
+
+	t2 := (&gfP2{}).Square(&a.y.x)
+	t3 := (&gfP2{}).Square(&a.x.z)
+	t7 := (&gfP2{}).Add(&a.y.x, &a.x.z)
+	t7.Square(t7).Sub(t7, t2).Sub(t7, t3) // 2·a.y.x·a.x.z
+
+	t4 := (&gfP2{}).Square(&a.x.x)
+	t5 := (&gfP2{}).Square(&a.y.y)
+	t8 := (&gfP2{}).Add(&a.x.x, &a.y.y)
+	t8.Square(t8).Sub(t8, t4).Sub(t8, t5).MulXi(t8) // 2·a.x.x·a.y.y·ξ
+
+	t0.MulXi(t0).Add(t0, t1) // a.x.y²·ξ + a.y.z²
+	t2.MulXi(t2).Add(t2, t3) // a.y.x²·ξ + a.x.z²
+	t4.MulXi(t4).Add(t4, t5) // a.x.x²·ξ + a.y.y²
+
+	// The square is then 3t - 2·conj(a) in each component
+	r := &gfP12{}
+	r.y.z.Sub(t0, &a.y.z).Add(&r.y.z, &r.y.z).Add(&r.y.z, t0)
+	r.y.y.Sub(t2, &a.y.y).Add(&r.y.y, &r.y.y).Add(&r.y.y, t2)
+	r.y.x.Sub(t4, &a.y.x).Add(&r.y.x, &r.y.x).Add(&r.y.x, t4)
+	r.x.z.Add(t8, &a.x.z).Add(&r.x.z, &r.x.z).Add(&r.x.z, t8)
+	r.x.y.Add(t6, &a.x.y).Add(&r.x.y, &r.x.y).Add(&r.x.y, t6)
+	r.x.x.Add(t7, &a.x.x).Add(&r.x.x, &r.x.x).Add(&r.x.x, t7)
+
+	e.Set(r)
+	return e
+}
+
 func (e *gfP12) Invert(a *gfP12) *gfP12 {
 	// See "Implementing cryptographic pairings", M. Scott, section 3.2.
 	// ftp://136.206.11.249/pub/crypto/pairings.pdf
@@ -149,6 +149,54 @@ func (e *gfP2) Invert(a *gfP2) *gfP2 {
 	return e
 }
 
+// Sqrt sets e to a square root of a and reports whether a is a square, with
+// algorithm 9 of "Square root computation over even extension fields",
+// Adj and Rodríguez-Henríquez, https://eprint.iacr.org/2012/685.pdf, which
+// applies as p ≡ 3 mod 4.
+func (e *gfP2) Sqrt(a *gfP2) bool {
+	a1 := (&gfP2{}).exp(a, pMinus3Over4)
+	x0 := (&gfP2{}).Mul(a1, a)     // a^((p+1)/4)
+	alpha := (&gfP2{}).Mul(a1, x0) // a^((p-1)/2)
+	minusOne := (&gfP2{}).SetOne()
+	minusOne.Neg(minusOne)
+
+	root := &gfP2{}
+	if *alpha == *minusOne {
+		// root = i·x0
+		root.x.Set(&x0.y)
+		gfpNeg(&root.y, &x0.x)
+	} else {
+		b := (&gfP2{}).SetOne()
+		b.Add(b, alpha).exp(b, pMinus1Over2)
+		root.Mul(b, x0)
+	}
+
+	if *(&gfP2{}).Square(root) != *a {
+		return false
+	}
+	e.Set(root)
+	return true
+}
+
+// exp sets e to a^bits, where the exponent bits is given as little-endian
+// 64-bit words, and returns e. It runs in variable time.
+func (e *gfP2) exp(a *gfP2, bits [4]uint64) *gfP2 {
+	sum := (&gfP2{}).SetOne()
+	power := (&gfP2{}).Set(a)
+
+	for word := 0; word < 4; word++ {
+		for bit := uint(0); bit < 64; bit++ {
+			if (bits[word]>>bit)&1 == 1 {
+				sum.Mul(sum, power)
+			}
+			power.Square(power)
+		}
+	}
+
+	e.Set(sum)
+	return e
+}
+
 // Clone makes a hard copy of the field
 func (e *gfP2) Clone() gfP2 {
 	n := gfP2{}
@@ -10,6 +10,13 @@ import (
 type groupG1 struct {
 	common
 	*commonSuite
+
+	// compressed makes the points of the group use the compressed encoding.
+	compressed bool
+
+	// svdw makes the points of the group hash with the Shallue–van de
+	// Woestijne map.
+	svdw bool
 }
 
 func (g *groupG1) String() string {
@@ -17,16 +24,22 @@ func (g *groupG1) String() string {
 }
 
 func (g *groupG1) PointLen() int {
-	return newPointG1().MarshalSize()
+	return g.Point().MarshalSize()
 }
 
 func (g *groupG1) Point() kyber.Point {
-	return newPointG1()
+	p := newPointG1()
+	p.compressed = g.compressed
+	p.svdw = g.svdw
+	return p
 }
 
 type groupG2 struct {
 	common
 	*commonSuite
+
+	// compressed makes the points of the group use the compressed encoding.
+	compressed bool
 }
 
 func (g *groupG2) String() string {
@@ -34,16 +47,21 @@ func (g *groupG2) String() string {
 }
 
 func (g *groupG2) PointLen() int {
-	return newPointG2().MarshalSize()
+	return g.Point().MarshalSize()
 }
 
 func (g *groupG2) Point() kyber.Point {
-	return newPointG2()
+	p := newPointG2()
+	p.compressed = g.compressed
+	return p
 }
 
 type groupGT struct {
 	common
 	*commonSuite
+
+	// compressed makes the points of the group use the compressed encoding.
+	compressed bool
 }
 
 func (g *groupGT) String() string {
@@ -51,11 +69,13 @@ func (g *groupGT) String() string {
 }
 
 func (g *groupGT) PointLen() int {
-	return newPointGT().MarshalSize()
+	return g.Point().MarshalSize()
 }
 
 func (g *groupGT) Point() kyber.Point {
-	return newPointGT()
+	p := newPointGT()
+	p.compressed = g.compressed
+	return p
 }
 
 // common functionalities across G1, G2, and GT
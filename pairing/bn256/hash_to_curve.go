@@ -0,0 +1,140 @@
+package bn256
+
+import (
+	"crypto/sha256"
+)
+
+// hashDST is the domain separation tag of the Shallue–van de Woestijne hash
+// to G₁, following the naming convention of RFC 9380, section 3.1.
+const hashDST = "KYBER-V01-CS02-with-BN256G1_XMD:SHA-256_SVDW_RO_"
+
+// hashSvdW sets c to the hash of m onto G₁ with the hash_to_curve construction
+// of RFC 9380, using expand_message_xmd with SHA-256, the Shallue–van de
+// Woestijne map and the domain separation tag dst. As G₁ is the whole curve,
+// no cofactor has to be cleared. It runs in constant time.
+func (c *curvePoint) hashSvdW(m, dst []byte) {
+	var uniform [96]byte
+	expandMessageXMD(uniform[:], m, dst)
+
+	u, q := &gfP{}, &curvePoint{}
+	gfpFromHashBytes(u, uniform[:48])
+	c.mapSvdW(u)
+	gfpFromHashBytes(u, uniform[48:])
+	q.mapSvdW(u)
+
+	// The two points are only equal or opposite with negligible probability,
+	// so that the branches of Add are never taken
+	c.Add(c, q)
+}
+
+// mapSvdW sets c to the image of u under the Shallue–van de Woestijne map of
+// RFC 9380, section 6.6.1, with Z = 1. It runs in constant time.
+func (c *curvePoint) mapSvdW(u *gfP) {
+	one := newGFp(1)
+	tv1, tv2, tv3, tv4 := &gfP{}, &gfP{}, &gfP{}, &gfP{}
+	gfpMul(tv1, u, u)
+	gfpAdd(tv1, tv1, tv1)
+	gfpAdd(tv1, tv1, tv1) // c1·u², where c1 = g(Z) = 4
+	gfpAdd(tv2, one, tv1)
+	gfpSub(tv1, one, tv1)
+	gfpMul(tv3, tv1, tv2)
+	tv3.Invert(tv3) // zero if tv1·tv2 is
+	gfpMul(tv4, u, tv1)
+	gfpMul(tv4, tv4, tv3)
+	gfpMul(tv4, tv4, svdwC3)
+
+	x1, x2, x3 := &gfP{}, &gfP{}, &gfP{}
+	y1, y2, y3 := &gfP{}, &gfP{}, &gfP{}
+	gx := &gfP{}
+
+	gfpSub(x1, svdwC2, tv4)
+	curveRHS(gx, x1)
+	e1 := y1.sqrt(gx)
+
+	gfpAdd(x2, svdwC2, tv4)
+	curveRHS(gx, x2)
+	e2 := y2.sqrt(gx)
+
+	// g(x3) is a square whenever neither g(x1) nor g(x2) is
+	gfpMul(x3, tv2, tv2)
+	gfpMul(x3, x3, tv3)
+	gfpMul(x3, x3, x3)
+	gfpMul(x3, x3, svdwC4)
+	gfpAdd(x3, x3, one)
+	curveRHS(gx, x3)
+	y3.sqrt(gx)
+
+	x3.cmov(x2, e2)
+	y3.cmov(y2, e2)
+	x3.cmov(x1, e1)
+	y3.cmov(y1, e1)
+
+	// Give y the sign of u
+	gfpNeg(y1, y3)
+	y3.cmov(y1, u.sgn0()^y3.sgn0())
+
+	c.x.Set(x3)
+	c.y.Set(y3)
+	c.z.Set(one)
+	c.t.Set(one)
+}
+
+// curveRHS sets e to x³+3, the right-hand side of the curve equation.
+func curveRHS(e, x *gfP) {
+	gfpMul(e, x, x)
+	gfpMul(e, e, x)
+	gfpAdd(e, e, curveB)
+}
+
+// gfpFromHashBytes sets e to the 48-byte big-endian integer b modulo p, as
+// hash_to_field of RFC 9380 reads it.
+func gfpFromHashBytes(e *gfP, b []byte) {
+	var buf [32]byte
+	lo, hi := &gfP{}, &gfP{}
+	lo.Unmarshal(b[16:])
+	copy(buf[16:], b[:16])
+	hi.Unmarshal(buf[:])
+
+	// b = hi·2²⁵⁶ + lo. Montgomery multiplication by R² reduces lo, which is
+	// below 2p, and the one by R³ gives hi·R in Montgomery form
+	montEncode(lo, lo)
+	gfpMul(hi, hi, r3)
+	gfpAdd(e, lo, hi)
+}
+
+// expandMessageXMD fills out with expand_message_xmd of RFC 9380, section
+// 5.3.1, using SHA-256. out must be at most 255*32 bytes long.
+func expandMessageXMD(out []byte, msg, dst []byte) {
+	h := sha256.New()
+	if len(dst) > 255 {
+		_, _ = h.Write([]byte("H2C-OVERSIZE-DST-"))
+		_, _ = h.Write(dst)
+		dst = h.Sum(nil)
+		h.Reset()
+	}
+	dstLen := []byte{byte(len(dst))}
+
+	// b_0 = H(Z_pad || msg || l_i_b_str || 0 || DST_prime)
+	var zPad [64]byte
+	_, _ = h.Write(zPad[:])
+	_, _ = h.Write(msg)
+	_, _ = h.Write([]byte{byte(len(out) >> 8), byte(len(out)), 0})
+	_, _ = h.Write(dst)
+	_, _ = h.Write(dstLen)
+	var b0, bi [sha256.Size]byte
+	h.Sum(b0[:0])
+
+	// b_i = H((b_0 xor b_(i-1)) || i || DST_prime), taking b_0 for b_1's input
+	for i := 1; len(out) > 0; i++ {
+		for j := range bi {
+			bi[j] ^= b0[j]
+		}
+		h.Reset()
+		_, _ = h.Write(bi[:])
+		_, _ = h.Write([]byte{byte(i)})
+		_, _ = h.Write(dst)
+		_, _ = h.Write(dstLen)
+		h.Sum(bi[:0])
+		out = out[copy(out, bi[:]):]
+	}
+}
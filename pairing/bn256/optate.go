@@ -1,6 +1,12 @@
 package bn256
 
-func lineFunctionAdd(r, p *twistPoint, q *curvePoint, r2 *gfP2) (a, b, c *gfP2, rOut *twistPoint) {
+// The line functions return the coefficients a, b and c of the line through
+// r and p, or tangent at r, along with the sum or double rOut. b and c are
+// yet to be multiplied by the x and y coordinates of the G1 point of the
+// pairing, so the lines of a G2 point can be computed once for all pairings
+// with it, see prepareLines.
+
+func lineFunctionAdd(r, p *twistPoint, r2 *gfP2) (a, b, c *gfP2, rOut *twistPoint) {
 	// See the mixed addition algorithm from "Faster Computation of the
 	// Tate Pairing", http://arxiv.org/pdf/0904.0854v3.pdf
 	B := (&gfP2{}).Mul(&p.x, &r.t)
@@ -40,16 +46,15 @@ func lineFunctionAdd(r, p *twistPoint, q *curvePoint, r2 *gfP2) (a, b, c *gfP2,
 	t2.Add(t2, t2)
 	a = (&gfP2{}).Sub(t2, t)
 
-	c = (&gfP2{}).MulScalar(&rOut.z, &q.y)
-	c.Add(c, c)
+	c = (&gfP2{}).Add(&rOut.z, &rOut.z)
 
 	b = (&gfP2{}).Neg(L1)
-	b.MulScalar(b, &q.x).Add(b, b)
+	b.Add(b, b)
 
 	return
 }
 
-func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twistPoint) {
+func lineFunctionDouble(r *twistPoint) (a, b, c *gfP2, rOut *twistPoint) {
 	// See the doubling algorithm for a=0 from "Faster Computation of the
 	// Tate Pairing", http://arxiv.org/pdf/0904.0854v3.pdf
 	A := (&gfP2{}).Square(&r.x)
@@ -78,7 +83,6 @@ func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twis
 
 	t.Mul(E, &r.t).Add(t, t)
 	b = (&gfP2{}).Neg(t)
-	b.MulScalar(b, &q.x)
 
 	a = (&gfP2{}).Add(&r.x, E)
 	a.Square(a).Sub(a, A).Sub(a, G)
@@ -86,7 +90,7 @@ func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twis
 	a.Sub(a, t)
 
 	c = (&gfP2{}).Mul(&rOut.z, &r.t)
-	c.Add(c, c).MulScalar(c, &q.y)
+	c.Add(c, c)
 
 	return
 }
@@ -114,19 +118,25 @@ func mulLine(ret *gfP12, a, b, c *gfP2) {
 // sixuPlus2NAF is 6u+2 in non-adjacent form.
 var sixuPlus2NAF = []int8{0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1}
 
-// miller implements the Miller loop for calculating the Optimal Ate pairing.
+// line holds the coefficients of a line function of the Miller loop, as
+// returned by the line functions.
+type line struct {
+	a, b, c gfP2
+}
+
+// prepareLines computes the lines of the Miller loop for the G2 point q, in
+// the order in which millerLines uses them. They only depend on q.
 // See algorithm 1 from http://cryptojedi.org/papers/dclxvi-20100714.pdf
-func miller(q *twistPoint, p *curvePoint) *gfP12 {
-	ret := (&gfP12{}).SetOne()
+func prepareLines(q *twistPoint) []line {
+	lines := make([]line, 0, len(sixuPlus2NAF)+24)
+	push := func(a, b, c *gfP2) {
+		lines = append(lines, line{a: *a, b: *b, c: *c})
+	}
 
 	aAffine := &twistPoint{}
 	aAffine.Set(q)
 	aAffine.MakeAffine()
 
-	bAffine := &curvePoint{}
-	bAffine.Set(p)
-	bAffine.MakeAffine()
-
 	minusA := &twistPoint{}
 	minusA.Neg(aAffine)
 
@@ -136,24 +146,20 @@ func miller(q *twistPoint, p *curvePoint) *gfP12 {
 	r2 := (&gfP2{}).Square(&aAffine.y)
 
 	for i := len(sixuPlus2NAF) - 1; i > 0; i-- {
-		a, b, c, newR := lineFunctionDouble(r, bAffine)
-		if i != len(sixuPlus2NAF)-1 {
-			ret.Square(ret)
-		}
-
-		mulLine(ret, a, b, c)
+		a, b, c, newR := lineFunctionDouble(r)
+		push(a, b, c)
 		r = newR
 
 		switch sixuPlus2NAF[i-1] {
 		case 1:
-			a, b, c, newR = lineFunctionAdd(r, aAffine, bAffine, r2)
+			a, b, c, newR = lineFunctionAdd(r, aAffine, r2)
 		case -1:
-			a, b, c, newR = lineFunctionAdd(r, minusA, bAffine, r2)
+			a, b, c, newR = lineFunctionAdd(r, minusA, r2)
 		default:
 			continue
 		}
 
-		mulLine(ret, a, b, c)
+		push(a, b, c)
 		r = newR
 	}
 
@@ -191,14 +197,64 @@ func miller(q *twistPoint, p *curvePoint) *gfP12 {
 	minusQ2.t.SetOne()
 
 	r2.Square(&q1.y)
-	a, b, c, newR := lineFunctionAdd(r, q1, bAffine, r2)
-	mulLine(ret, a, b, c)
+	a, b, c, newR := lineFunctionAdd(r, q1, r2)
+	push(a, b, c)
 	r = newR
 
 	r2.Square(&minusQ2.y)
-	a, b, c, newR = lineFunctionAdd(r, minusQ2, bAffine, r2)
-	mulLine(ret, a, b, c)
-	r = newR
+	a, b, c, _ = lineFunctionAdd(r, minusQ2, r2)
+	push(a, b, c)
+
+	return lines
+}
+
+// mulPreparedLine multiplies ret by the line l evaluated at the affine G1
+// point p.
+func mulPreparedLine(ret *gfP12, l *line, p *curvePoint) {
+	b := (&gfP2{}).MulScalar(&l.b, &p.x)
+	c := (&gfP2{}).MulScalar(&l.c, &p.y)
+	mulLine(ret, &l.a, b, c)
+}
+
+// millerLines implements the Miller loop for calculating the Optimal Ate
+// pairing. See algorithm 1 from
+// http://cryptojedi.org/papers/dclxvi-20100714.pdf
+//
+// It computes the product of the Miller loops of the G1 points p[k] with
+// the G2 points whose lines are lines[k], as computed by prepareLines. The
+// loops run in step, so the accumulator is squared once per step for all
+// the pairs instead of once per pair.
+func millerLines(lines [][]line, p []*curvePoint) *gfP12 {
+	ret := (&gfP12{}).SetOne()
+
+	bAffine := make([]curvePoint, len(p))
+	for k := range p {
+		bAffine[k].Set(p[k])
+		bAffine[k].MakeAffine()
+	}
+
+	j := 0 // index of the next line of every pair
+	for i := len(sixuPlus2NAF) - 1; i > 0; i-- {
+		if i != len(sixuPlus2NAF)-1 {
+			ret.Square(ret)
+		}
+
+		n := 1
+		if sixuPlus2NAF[i-1] != 0 {
+			n = 2
+		}
+		for k := range p {
+			for l := j; l < j+n; l++ {
+				mulPreparedLine(ret, &lines[k][l], &bAffine[k])
+			}
+		}
+		j += n
+	}
+
+	for k := range p {
+		mulPreparedLine(ret, &lines[k][j], &bAffine[k])
+		mulPreparedLine(ret, &lines[k][j+1], &bAffine[k])
+	}
 
 	return ret
 }
@@ -224,9 +280,10 @@ func finalExponentiation(in *gfP12) *gfP12 {
 	fp2 := (&gfP12{}).FrobeniusP2(t1)
 	fp3 := (&gfP12{}).Frobenius(fp2)
 
-	fu := (&gfP12{}).Exp(t1, u)
-	fu2 := (&gfP12{}).Exp(fu, u)
-	fu3 := (&gfP12{}).Exp(fu2, u)
+	// From here on all elements are in the cyclotomic subgroup
+	fu := (&gfP12{}).CyclotomicExp(t1, u)
+	fu2 := (&gfP12{}).CyclotomicExp(fu, u)
+	fu3 := (&gfP12{}).CyclotomicExp(fu2, u)
 
 	y3 := (&gfP12{}).Frobenius(fu)
 	fu2p := (&gfP12{}).Frobenius(fu2)
@@ -245,24 +302,21 @@ func finalExponentiation(in *gfP12) *gfP12 {
 	y6 := (&gfP12{}).Mul(fu3, fu3p)
 	y6.Conjugate(y6)
 
-	t0 := (&gfP12{}).Square(y6)
+	t0 := (&gfP12{}).CyclotomicSquare(y6)
 	t0.Mul(t0, y4).Mul(t0, y5)
 	t1.Mul(y3, y5).Mul(t1, t0)
 	t0.Mul(t0, y2)
-	t1.Square(t1).Mul(t1, t0).Square(t1)
+	t1.CyclotomicSquare(t1).Mul(t1, t0).CyclotomicSquare(t1)
 	t0.Mul(t1, y1)
 	t1.Mul(t1, y0)
-	t0.Square(t0).Mul(t0, t1)
+	t0.CyclotomicSquare(t0).Mul(t0, t1)
 
 	return t0
 }
 
-func optimalAte(a *twistPoint, b *curvePoint) *gfP12 {
-	e := miller(a, b)
-	ret := finalExponentiation(e)
-
-	if a.IsInfinity() || b.IsInfinity() {
-		ret.SetOne()
-	}
-	return ret
+// optimalAteLines computes the product of the pairings of the G1 points b[k]
+// with the G2 points whose lines are lines[k], with a single Miller loop and
+// a single final exponentiation. None of the points may be at infinity.
+func optimalAteLines(lines [][]line, b []*curvePoint) *gfP12 {
+	return finalExponentiation(millerLines(lines, b))
 }
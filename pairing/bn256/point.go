@@ -7,6 +7,7 @@ import (
 	"errors"
 	"io"
 	"math/big"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/mod"
@@ -15,9 +16,19 @@ import (
 var marshalPointID1 = [8]byte{'b', 'n', '2', '5', '6', '.', 'g', '1'}
 var marshalPointID2 = [8]byte{'b', 'n', '2', '5', '6', '.', 'g', '2'}
 var marshalPointIDT = [8]byte{'b', 'n', '2', '5', '6', '.', 'g', 't'}
+var marshalPointID1c = [8]byte{'b', 'n', '2', '5', '6', '.', 'c', '1'}
+var marshalPointID2c = [8]byte{'b', 'n', '2', '5', '6', '.', 'c', '2'}
+var marshalPointIDTc = [8]byte{'b', 'n', '2', '5', '6', '.', 'c', 't'}
 
 type pointG1 struct {
 	g *curvePoint
+
+	// compressed selects the compressed encoding and its marshal ID.
+	compressed bool
+
+	// svdw makes Hash use the Shallue–van de Woestijne map instead of
+	// hashToPoint.
+	svdw bool
 }
 
 func newPointG1() *pointG1 {
@@ -26,8 +37,14 @@ func newPointG1() *pointG1 {
 }
 
 func (p *pointG1) Equal(q kyber.Point) bool {
-	x, _ := p.MarshalBinary()
-	y, _ := q.MarshalBinary()
+	// Compare the uncompressed encodings, which both kinds of points share
+	x, _ := p.appendUncompressed(nil)
+	var y []byte
+	if r, ok := q.(*pointG1); ok {
+		y, _ = r.appendUncompressed(nil)
+	} else {
+		y, _ = q.MarshalBinary()
+	}
 	return subtle.ConstantTimeCompare(x, y) == 1
 }
 
@@ -58,6 +75,8 @@ func (p *pointG1) Set(q kyber.Point) kyber.Point {
 func (p *pointG1) Clone() kyber.Point {
 	q := newPointG1()
 	q.g = p.g.Clone()
+	q.compressed = p.compressed
+	q.svdw = p.svdw
 	return q
 }
 
@@ -107,28 +126,65 @@ func (p *pointG1) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
 	return p
 }
 
+// MultiScalarMul sets p to the sum of scalars[i]*points[i] and returns p,
+// where a nil entry in points stands for the base point. It shares the
+// doublings between all terms and runs in variable time, so it must only be
+// used on public Scalars and Points.
+func (p *pointG1) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("bn256.G1: mismatched number of scalars and points")
+	}
+	a := make([]*curvePoint, len(points))
+	k := make([]*big.Int, len(scalars))
+	for i := range points {
+		if points[i] == nil {
+			a[i] = curveGen
+		} else {
+			a[i] = points[i].(*pointG1).g
+		}
+		k[i] = &scalars[i].(*mod.Int).V
+	}
+	p.g.MultiMul(a, k)
+	return p
+}
+
 func (p *pointG1) MarshalBinary() ([]byte, error) {
-	// Clone is required as we change the point
-	p = p.Clone().(*pointG1)
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
 
+// AppendBinary appends the encoding of MarshalBinary to buf.
+func (p *pointG1) AppendBinary(buf []byte) ([]byte, error) {
+	if p.compressed {
+		return p.appendCompressed(buf)
+	}
+	return p.appendUncompressed(buf)
+}
+
+func (p *pointG1) appendUncompressed(buf []byte) ([]byte, error) {
 	n := p.ElementSize()
 	// Take a copy so that p is not written to, so calls to MarshalBinary
 	// are threadsafe.
 	pgtemp := *p.g
 	pgtemp.MakeAffine()
-	ret := make([]byte, p.MarshalSize())
+	buf, ret := sliceForAppend(buf, 2*n)
 	if pgtemp.IsInfinity() {
-		return ret, nil
+		for i := range ret {
+			ret[i] = 0
+		}
+		return buf, nil
 	}
 	tmp := &gfP{}
 	montDecode(tmp, &pgtemp.x)
 	tmp.Marshal(ret)
 	montDecode(tmp, &pgtemp.y)
 	tmp.Marshal(ret[n:])
-	return ret, nil
+	return buf, nil
 }
 
 func (p *pointG1) MarshalID() [8]byte {
+	if p.compressed {
+		return marshalPointID1c
+	}
 	return marshalPointID1
 }
 
@@ -140,10 +196,12 @@ func (p *pointG1) MarshalTo(w io.Writer) (int, error) {
 	return w.Write(buf)
 }
 
+// UnmarshalBinary decodes either encoding of a point, whatever kind p is:
+// buffers shorter than the uncompressed encoding are taken as compressed.
 func (p *pointG1) UnmarshalBinary(buf []byte) error {
 	n := p.ElementSize()
-	if len(buf) < p.MarshalSize() {
-		return errors.New("bn256.G1: not enough data")
+	if len(buf) < 2*n {
+		return p.unmarshalCompressed(buf)
 	}
 	if p.g == nil {
 		p.g = &curvePoint{}
@@ -184,6 +242,9 @@ func (p *pointG1) UnmarshalFrom(r io.Reader) (int, error) {
 }
 
 func (p *pointG1) MarshalSize() int {
+	if p.compressed {
+		return 1 + p.ElementSize()
+	}
 	return 2 * p.ElementSize()
 }
 
@@ -195,7 +256,20 @@ func (p *pointG1) String() string {
 	return "bn256.G1" + p.g.String()
 }
 
+// Hash sets p to the hash of m onto G1. By default, it uses hashToPoint, which
+// tries successive x coordinates in variable time; points of a suite made
+// with the HashSvdW option instead use the constant-time hash_to_curve of
+// RFC 9380 with the Shallue–van de Woestijne map. The two give different
+// points.
 func (p *pointG1) Hash(m []byte) kyber.Point {
+	if p.svdw {
+		if p.g == nil {
+			p.g = new(curvePoint)
+		}
+		p.g.hashSvdW(m, []byte(hashDST))
+		return p
+	}
+
 	leftPad32 := func(in []byte) []byte {
 		if len(in) > 32 {
 			panic("input cannot be more than 32 bytes")
@@ -255,6 +329,25 @@ func hashToPoint(m []byte) (*big.Int, *big.Int) {
 
 type pointG2 struct {
 	g *twistPoint
+
+	// compressed selects the compressed encoding and its marshal ID.
+	compressed bool
+
+	// prepared holds the Miller loop lines of the value that g had when
+	// Precompute was last called, or nil.
+	prepared *preparedG2
+}
+
+type preparedG2 struct {
+	g     twistPoint
+	lines []line
+}
+
+// baseG2Prepared holds the Miller loop lines of the generator of G2, which
+// Base attaches to its points. They are computed on first use.
+var baseG2Prepared struct {
+	once     sync.Once
+	prepared *preparedG2
 }
 
 func newPointG2() *pointG2 {
@@ -263,8 +356,14 @@ func newPointG2() *pointG2 {
 }
 
 func (p *pointG2) Equal(q kyber.Point) bool {
-	x, _ := p.MarshalBinary()
-	y, _ := q.MarshalBinary()
+	// Compare the uncompressed encodings, which both kinds of points share
+	x, _ := p.appendUncompressed(nil)
+	var y []byte
+	if r, ok := q.(*pointG2); ok {
+		y, _ = r.appendUncompressed(nil)
+	} else {
+		y, _ = q.MarshalBinary()
+	}
 	return subtle.ConstantTimeCompare(x, y) == 1
 }
 
@@ -275,6 +374,10 @@ func (p *pointG2) Null() kyber.Point {
 
 func (p *pointG2) Base() kyber.Point {
 	p.g.Set(twistGen)
+	baseG2Prepared.once.Do(func() {
+		baseG2Prepared.prepared = &preparedG2{g: *p.g, lines: prepareLines(p.g)}
+	})
+	p.prepared = baseG2Prepared.prepared
 	return p
 }
 
@@ -288,6 +391,7 @@ func (p *pointG2) Pick(rand cipher.Stream) kyber.Point {
 func (p *pointG2) Set(q kyber.Point) kyber.Point {
 	x := q.(*pointG2).g
 	p.g.Set(x)
+	p.prepared = q.(*pointG2).prepared
 	return p
 }
 
@@ -295,9 +399,43 @@ func (p *pointG2) Set(q kyber.Point) kyber.Point {
 func (p *pointG2) Clone() kyber.Point {
 	q := newPointG2()
 	q.g = p.g.Clone()
+	q.prepared = p.prepared
+	q.compressed = p.compressed
 	return q
 }
 
+// Precompute computes the line functions of the Miller loop for p, which
+// only depend on p, so that subsequent pairings with p skip all the
+// arithmetic in G2, about a third of the cost of a pairing. This pays off
+// for long-lived points such as public keys. The lines take 16 KB of
+// memory. They are shared by copies of p made with Set and Clone, and are
+// no longer used once p is set to another value. The points returned by
+// Base come with their lines.
+func (p *pointG2) Precompute() {
+	if p.preparedLines() != nil {
+		return
+	}
+	p.prepared = &preparedG2{g: *p.g, lines: prepareLines(p.g)}
+}
+
+// preparedLines returns the lines computed by Precompute, or nil if there
+// are none for p's current value.
+func (p *pointG2) preparedLines() []line {
+	if p.prepared == nil || p.prepared.g != *p.g {
+		return nil
+	}
+	return p.prepared.lines
+}
+
+// millerLines returns the Miller loop lines of p, computing them unless
+// Precompute already did.
+func (p *pointG2) millerLines() []line {
+	if lines := p.preparedLines(); lines != nil {
+		return lines
+	}
+	return prepareLines(p.g)
+}
+
 func (p *pointG2) EmbedLen() int {
 	panic("bn256.G2: unsupported operation")
 }
@@ -338,36 +476,75 @@ func (p *pointG2) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
 	return p
 }
 
+// MultiScalarMul sets p to the sum of scalars[i]*points[i] and returns p,
+// where a nil entry in points stands for the base point. It shares the
+// doublings between all terms and runs in variable time, so it must only be
+// used on public Scalars and Points.
+func (p *pointG2) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("bn256.G2: mismatched number of scalars and points")
+	}
+	a := make([]*twistPoint, len(points))
+	k := make([]*big.Int, len(scalars))
+	for i := range points {
+		if points[i] == nil {
+			a[i] = twistGen
+		} else {
+			a[i] = points[i].(*pointG2).g
+		}
+		k[i] = &scalars[i].(*mod.Int).V
+	}
+	p.g.MultiMul(a, k)
+	return p
+}
+
 func (p *pointG2) MarshalBinary() ([]byte, error) {
-	// Clone is required as we change the point during the operation
-	p = p.Clone().(*pointG2)
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
 
-	n := p.ElementSize()
-	if p.g == nil {
-		p.g = &twistPoint{}
+// AppendBinary appends the encoding of MarshalBinary to buf.
+func (p *pointG2) AppendBinary(buf []byte) ([]byte, error) {
+	if p.compressed {
+		return p.appendCompressed(buf)
 	}
+	return p.appendUncompressed(buf)
+}
 
-	p.g.MakeAffine()
+func (p *pointG2) appendUncompressed(buf []byte) ([]byte, error) {
+	n := p.ElementSize()
 
-	ret := make([]byte, p.MarshalSize())
-	if p.g.IsInfinity() {
-		return ret, nil
+	// Take a copy as making the point affine changes it
+	var g twistPoint
+	if p.g != nil {
+		g = *p.g
+	}
+	g.MakeAffine()
+
+	buf, ret := sliceForAppend(buf, 4*n)
+	if g.IsInfinity() {
+		for i := range ret {
+			ret[i] = 0
+		}
+		return buf, nil
 	}
 
 	temp := &gfP{}
-	montDecode(temp, &p.g.x.x)
+	montDecode(temp, &g.x.x)
 	temp.Marshal(ret[0*n:])
-	montDecode(temp, &p.g.x.y)
+	montDecode(temp, &g.x.y)
 	temp.Marshal(ret[1*n:])
-	montDecode(temp, &p.g.y.x)
+	montDecode(temp, &g.y.x)
 	temp.Marshal(ret[2*n:])
-	montDecode(temp, &p.g.y.y)
+	montDecode(temp, &g.y.y)
 	temp.Marshal(ret[3*n:])
 
-	return ret, nil
+	return buf, nil
 }
 
 func (p *pointG2) MarshalID() [8]byte {
+	if p.compressed {
+		return marshalPointID2c
+	}
 	return marshalPointID2
 }
 
@@ -379,14 +556,16 @@ func (p *pointG2) MarshalTo(w io.Writer) (int, error) {
 	return w.Write(buf)
 }
 
+// UnmarshalBinary decodes either encoding of a point, whatever kind p is:
+// buffers shorter than the uncompressed encoding are taken as compressed.
 func (p *pointG2) UnmarshalBinary(buf []byte) error {
 	n := p.ElementSize()
 	if p.g == nil {
 		p.g = &twistPoint{}
 	}
 
-	if len(buf) < p.MarshalSize() {
-		return errors.New("bn256.G2: not enough data")
+	if len(buf) < 4*n {
+		return p.unmarshalCompressed(buf)
 	}
 
 	p.g.x.x.Unmarshal(buf[0*n:])
@@ -410,6 +589,9 @@ func (p *pointG2) UnmarshalBinary(buf []byte) error {
 		if !p.g.IsOnCurve() {
 			return errors.New("bn256.G2: malformed point")
 		}
+		if !p.g.IsInG2() {
+			return errors.New("bn256.G2: point is not in G2")
+		}
 	}
 	return nil
 }
@@ -424,6 +606,9 @@ func (p *pointG2) UnmarshalFrom(r io.Reader) (int, error) {
 }
 
 func (p *pointG2) MarshalSize() int {
+	if p.compressed {
+		return 1 + 2*p.ElementSize()
+	}
 	return 4 * p.ElementSize()
 }
 
@@ -437,6 +622,14 @@ func (p *pointG2) String() string {
 
 type pointGT struct {
 	g *gfP12
+
+	// compressed selects the compressed encoding and its marshal ID.
+	compressed bool
+
+	// inGT records that g is known to be in GT, which Mul needs to split the
+	// exponent with the Frobenius map. It is cleared by Miller, whose output
+	// lies outside GT until it is finalized.
+	inGT bool
 }
 
 func newPointGT() *pointGT {
@@ -445,18 +638,26 @@ func newPointGT() *pointGT {
 }
 
 func (p *pointGT) Equal(q kyber.Point) bool {
-	x, _ := p.MarshalBinary()
-	y, _ := q.MarshalBinary()
+	// Compare the uncompressed encodings, which both kinds of points share
+	x, _ := p.appendUncompressed(nil)
+	var y []byte
+	if r, ok := q.(*pointGT); ok {
+		y, _ = r.appendUncompressed(nil)
+	} else {
+		y, _ = q.MarshalBinary()
+	}
 	return subtle.ConstantTimeCompare(x, y) == 1
 }
 
 func (p *pointGT) Null() kyber.Point {
 	p.g.Set(gfP12Inf)
+	p.inGT = true
 	return p
 }
 
 func (p *pointGT) Base() kyber.Point {
 	p.g.Set(gfP12Gen)
+	p.inGT = true
 	return p
 }
 
@@ -468,8 +669,9 @@ func (p *pointGT) Pick(rand cipher.Stream) kyber.Point {
 }
 
 func (p *pointGT) Set(q kyber.Point) kyber.Point {
-	x := q.(*pointGT).g
-	p.g.Set(x)
+	x := q.(*pointGT)
+	p.g.Set(x.g)
+	p.inGT = x.inGT
 	return p
 }
 
@@ -477,6 +679,8 @@ func (p *pointGT) Set(q kyber.Point) kyber.Point {
 func (p *pointGT) Clone() kyber.Point {
 	q := newPointGT()
 	q.g = p.g.Clone()
+	q.compressed = p.compressed
+	q.inGT = p.inGT
 	return q
 }
 
@@ -493,9 +697,10 @@ func (p *pointGT) Data() ([]byte, error) {
 }
 
 func (p *pointGT) Add(a, b kyber.Point) kyber.Point {
-	x := a.(*pointGT).g
-	y := b.(*pointGT).g
-	p.g.Mul(x, y)
+	x := a.(*pointGT)
+	y := b.(*pointGT)
+	p.g.Mul(x.g, y.g)
+	p.inGT = x.inGT && y.inGT
 	return p
 }
 
@@ -505,24 +710,46 @@ func (p *pointGT) Sub(a, b kyber.Point) kyber.Point {
 }
 
 func (p *pointGT) Neg(q kyber.Point) kyber.Point {
-	x := q.(*pointGT).g
-	p.g.Conjugate(x)
+	x := q.(*pointGT)
+	p.g.Conjugate(x.g)
+	p.inGT = x.inGT
 	return p
 }
 
+// Mul sets p to q raised to the power s. For elements of GT, such as the
+// outputs of Pair and decoded elements, it runs a fixed sequence of field
+// operations once s is split. Other elements, such as the output of Miller,
+// fall back to a plain exponentiation.
 func (p *pointGT) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
 	if q == nil {
 		q = newPointGT().Base()
 	}
 	t := s.(*mod.Int).V
-	r := q.(*pointGT).g
-	p.g.Exp(r, &t)
+	r := q.(*pointGT)
+	if r.inGT {
+		p.g.ExpGT(r.g, &t)
+	} else {
+		p.g.Exp(r.g, &t)
+	}
+	p.inGT = r.inGT
 	return p
 }
 
 func (p *pointGT) MarshalBinary() ([]byte, error) {
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
+
+// AppendBinary appends the encoding of MarshalBinary to buf.
+func (p *pointGT) AppendBinary(buf []byte) ([]byte, error) {
+	if p.compressed {
+		return p.appendCompressed(buf)
+	}
+	return p.appendUncompressed(buf)
+}
+
+func (p *pointGT) appendUncompressed(buf []byte) ([]byte, error) {
 	n := p.ElementSize()
-	ret := make([]byte, p.MarshalSize())
+	buf, ret := sliceForAppend(buf, 12*n)
 	temp := &gfP{}
 
 	montDecode(temp, &p.g.x.x.x)
@@ -550,10 +777,13 @@ func (p *pointGT) MarshalBinary() ([]byte, error) {
 	montDecode(temp, &p.g.y.z.y)
 	temp.Marshal(ret[11*n:])
 
-	return ret, nil
+	return buf, nil
 }
 
 func (p *pointGT) MarshalID() [8]byte {
+	if p.compressed {
+		return marshalPointIDTc
+	}
 	return marshalPointIDT
 }
 
@@ -565,10 +795,21 @@ func (p *pointGT) MarshalTo(w io.Writer) (int, error) {
 	return w.Write(buf)
 }
 
+// UnmarshalBinary decodes either encoding of an element, whatever kind p
+// is: buffers shorter than the uncompressed encoding are taken as compressed.
+// It rejects elements that are not in GT.
 func (p *pointGT) UnmarshalBinary(buf []byte) error {
 	n := p.ElementSize()
-	if len(buf) < p.MarshalSize() {
-		return errors.New("bn256.GT: not enough data")
+	p.inGT = false
+	if len(buf) < 12*n {
+		if err := p.unmarshalCompressed(buf); err != nil {
+			return err
+		}
+		if !p.g.IsInGT() {
+			return errors.New("bn256.GT: element is not in GT")
+		}
+		p.inGT = true
+		return nil
 	}
 
 	if p.g == nil {
@@ -600,8 +841,10 @@ func (p *pointGT) UnmarshalBinary(buf []byte) error {
 	montEncode(&p.g.y.z.x, &p.g.y.z.x)
 	montEncode(&p.g.y.z.y, &p.g.y.z.y)
 
-	// TODO: check if point is on curve
-
+	if !p.g.IsInGT() {
+		return errors.New("bn256.GT: element is not in GT")
+	}
+	p.inGT = true
 	return nil
 }
 
@@ -615,6 +858,9 @@ func (p *pointGT) UnmarshalFrom(r io.Reader) (int, error) {
 }
 
 func (p *pointGT) MarshalSize() int {
+	if p.compressed {
+		return 6 * p.ElementSize()
+	}
 	return 12 * p.ElementSize()
 }
 
@@ -629,19 +875,56 @@ func (p *pointGT) String() string {
 func (p *pointGT) Finalize() kyber.Point {
 	buf := finalExponentiation(p.g)
 	p.g.Set(buf)
+	p.inGT = true
 	return p
 }
 
 func (p *pointGT) Miller(p1, p2 kyber.Point) kyber.Point {
 	a := p1.(*pointG1).g
-	b := p2.(*pointG2).g
-	p.g.Set(miller(b, a))
+	lines := p2.(*pointG2).millerLines()
+	p.g.Set(millerLines([][]line{lines}, []*curvePoint{a}))
+	p.inGT = false
 	return p
 }
 
 func (p *pointGT) Pair(p1, p2 kyber.Point) kyber.Point {
-	a := p1.(*pointG1).g
-	b := p2.(*pointG2).g
-	p.g.Set(optimalAte(b, a))
+	return p.MultiPair([]kyber.Point{p1}, []kyber.Point{p2})
+}
+
+// MultiPair sets p to the product of the pairings of the points p1[i] of G1
+// and p2[i] of G2, computed with a single Miller loop and a single final
+// exponentiation, and returns p. It panics if the slices have different
+// lengths.
+func (p *pointGT) MultiPair(p1, p2 []kyber.Point) kyber.Point {
+	if len(p1) != len(p2) {
+		panic("bn256: mismatched number of G1 and G2 points")
+	}
+	var lines [][]line
+	var b []*curvePoint
+	for i := range p1 {
+		// Pairs with a point at infinity pair to one
+		a := p1[i].(*pointG1).g
+		q := p2[i].(*pointG2)
+		if a.IsInfinity() || q.g.IsInfinity() {
+			continue
+		}
+		lines = append(lines, q.millerLines())
+		b = append(b, a)
+	}
+	p.g.Set(optimalAteLines(lines, b))
+	p.inGT = true
 	return p
 }
+
+// sliceForAppend extends buf by n bytes, reallocating it only if its capacity
+// is too small, and returns the extended slice along with its last n bytes.
+func sliceForAppend(buf []byte, n int) (ret, tail []byte) {
+	if total := len(buf) + n; cap(buf) >= total {
+		ret = buf[:total]
+	} else {
+		ret = make([]byte, total)
+		copy(ret, buf)
+	}
+	tail = ret[len(buf):]
+	return
+}
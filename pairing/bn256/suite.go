@@ -37,12 +37,43 @@ type Suite struct {
 	gt *groupGT
 }
 
-// NewSuite generates and returns a new BN256 pairing suite.
-func NewSuite() *Suite {
+// Option configures a suite made by NewSuite or NewSuiteRand. Options can be
+// combined freely.
+type Option func(*Suite)
+
+// Compressed makes the points of a suite use the compressed encodings, under
+// marshal IDs of their own: 33 bytes in G1, 65 bytes in G2 and 192 bytes in
+// GT, instead of 64, 128 and 384 bytes. Points of either kind decode both
+// encodings, so that data written without the option stays readable.
+func Compressed() Option {
+	return func(s *Suite) {
+		s.g1.compressed = true
+		s.g2.compressed = true
+		s.gt.compressed = true
+	}
+}
+
+// HashSvdW makes the G1 points of a suite hash messages with the
+// constant-time hash_to_curve of RFC 9380, using the Shallue–van de Woestijne
+// map, instead of the try-and-increment method. The two methods hash to
+// different points, so signatures such as BLS ones made with one do not
+// verify with the other.
+func HashSvdW() Option {
+	return func(s *Suite) {
+		s.g1.svdw = true
+	}
+}
+
+// NewSuite generates and returns a new BN256 pairing suite, configured by
+// the given options.
+func NewSuite(opts ...Option) *Suite {
 	s := &Suite{commonSuite: &commonSuite{}}
 	s.g1 = &groupG1{commonSuite: s.commonSuite}
 	s.g2 = &groupG2{commonSuite: s.commonSuite}
 	s.gt = &groupGT{commonSuite: s.commonSuite}
+	for _, opt := range opts {
+		opt(s)
+	}
 	return s
 }
 
@@ -68,12 +99,15 @@ func NewSuiteGT() *Suite {
 }
 
 // NewSuiteRand generates and returns a new BN256 suite seeded by the
-// given cipher stream.
-func NewSuiteRand(rand cipher.Stream) *Suite {
+// given cipher stream, configured by the given options.
+func NewSuiteRand(rand cipher.Stream, opts ...Option) *Suite {
 	s := &Suite{commonSuite: &commonSuite{s: rand}}
 	s.g1 = &groupG1{commonSuite: s.commonSuite}
 	s.g2 = &groupG2{commonSuite: s.commonSuite}
 	s.gt = &groupGT{commonSuite: s.commonSuite}
+	for _, opt := range opts {
+		opt(s)
+	}
 	return s
 }
 
@@ -98,6 +132,15 @@ func (s *Suite) Pair(p1 kyber.Point, p2 kyber.Point) kyber.Point {
 	return s.GT().Point().(*pointGT).Pair(p1, p2)
 }
 
+// MultiPair takes the points p1[i] and p2[i] in groups G1 and G2,
+// respectively, as input and computes the product of their pairings in GT,
+// which is written as a sum in kyber. The pairs share a single Miller loop
+// and a single final exponentiation, which makes this much faster than
+// adding up the results of Pair.
+func (s *Suite) MultiPair(p1, p2 []kyber.Point) kyber.Point {
+	return s.GT().Point().(*pointGT).MultiPair(p1, p2)
+}
+
 // Not used other than for reflect.TypeOf()
 var aScalar kyber.Scalar
 var aPoint kyber.Point
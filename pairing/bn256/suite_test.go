@@ -3,6 +3,7 @@ package bn256
 import (
 	"bytes"
 	"fmt"
+	"math/big"
 	"testing"
 
 	"github.com/stretchr/testify/require"
@@ -113,6 +114,50 @@ func TestG1Ops(t *testing.T) {
 	}
 }
 
+func TestG1Mul(t *testing.T) {
+	suite := NewSuite()
+	a := suite.G1().Point().Pick(random.New()).(*pointG1).g
+
+	scalars := []*big.Int{
+		big.NewInt(0), big.NewInt(1), big.NewInt(2), big.NewInt(15), big.NewInt(16),
+		new(big.Int).Sub(Order, big.NewInt(1)), Order, new(big.Int).Add(Order, big.NewInt(5)),
+		glvLambda, new(big.Int).Neg(glvLambda), new(big.Int).Lsh(big.NewInt(1), 128),
+	}
+	for i := 0; i < 16; i++ {
+		scalars = append(scalars, &suite.G1().Scalar().Pick(random.New()).(*mod.Int).V)
+	}
+	for _, k := range scalars {
+		// Plain double-and-add
+		e := new(big.Int).Mod(k, Order)
+		expected, t2 := &curvePoint{}, &curvePoint{}
+		expected.SetInfinity()
+		for i := e.BitLen() - 1; i >= 0; i-- {
+			t2.Double(expected)
+			expected.Set(t2)
+			if e.Bit(i) != 0 {
+				t2.Add(expected, a)
+				expected.Set(t2)
+			}
+		}
+
+		p := &curvePoint{}
+		p.Mul(a, k)
+		require.True(t, (&pointG1{g: p}).Equal(&pointG1{g: expected}), "scalar %s", k)
+		p.MultiMul([]*curvePoint{a}, []*big.Int{k})
+		require.True(t, (&pointG1{g: p}).Equal(&pointG1{g: expected}), "scalar %s", k)
+	}
+}
+
+func BenchmarkG1Mul(b *testing.B) {
+	suite := NewSuite()
+	k := suite.G1().Scalar().Pick(random.New())
+	p := suite.G1().Point().Pick(random.New())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Mul(k, p)
+	}
+}
+
 func TestG2(t *testing.T) {
 	suite := NewSuite()
 	k := suite.G2().Scalar().Pick(random.New())
@@ -153,6 +198,34 @@ func TestG2MarshalZero(t *testing.T) {
 	require.Equal(t, ma, mb)
 }
 
+func TestG2UnmarshalMembership(t *testing.T) {
+	suite := NewSuite()
+	require.True(t, suite.G2().Point().Pick(random.New()).(*pointG2).g.IsInG2())
+
+	// Points of the twist outside G2 are rejected in either encoding, as the
+	// multiplications split the scalar with ψ, which only acts as p on G2
+	x, y2, y := &gfP2{}, &gfP2{}, &gfP2{}
+	for {
+		x.x.Set(randomGFp())
+		x.y.Set(randomGFp())
+		y2.Square(x).Mul(y2, x).Add(y2, twistB)
+		if y.Sqrt(y2) {
+			break
+		}
+	}
+	g := &twistPoint{x: *x, y: *y}
+	g.z.SetOne()
+	g.t.SetOne()
+	require.True(t, g.IsOnCurve())
+	require.False(t, g.IsInG2())
+
+	for _, compressed := range []bool{false, true} {
+		buf, err := (&pointG2{g: g, compressed: compressed}).MarshalBinary()
+		require.NoError(t, err)
+		require.Error(t, suite.G2().Point().UnmarshalBinary(buf))
+	}
+}
+
 func TestG2Ops(t *testing.T) {
 	suite := NewSuite()
 	a := suite.G2().Point().Pick(random.New())
@@ -174,6 +247,50 @@ func TestG2Ops(t *testing.T) {
 	}
 }
 
+func TestG2Mul(t *testing.T) {
+	suite := NewSuite()
+	a := suite.G2().Point().Pick(random.New()).(*pointG2).g
+
+	scalars := []*big.Int{
+		big.NewInt(0), big.NewInt(1), big.NewInt(2), big.NewInt(15), big.NewInt(16),
+		new(big.Int).Sub(Order, big.NewInt(1)), Order, new(big.Int).Add(Order, big.NewInt(5)),
+		p, new(big.Int).Neg(p), new(big.Int).Lsh(big.NewInt(1), 66),
+	}
+	for i := 0; i < 16; i++ {
+		scalars = append(scalars, &suite.G2().Scalar().Pick(random.New()).(*mod.Int).V)
+	}
+	for _, k := range scalars {
+		// Plain double-and-add
+		e := new(big.Int).Mod(k, Order)
+		expected, t2 := &twistPoint{}, &twistPoint{}
+		expected.SetInfinity()
+		for i := e.BitLen() - 1; i >= 0; i-- {
+			t2.Double(expected)
+			expected.Set(t2)
+			if e.Bit(i) != 0 {
+				t2.Add(expected, a)
+				expected.Set(t2)
+			}
+		}
+
+		q := &twistPoint{}
+		q.Mul(a, k)
+		require.True(t, (&pointG2{g: q}).Equal(&pointG2{g: expected}), "scalar %s", k)
+		q.MultiMul([]*twistPoint{a}, []*big.Int{k})
+		require.True(t, (&pointG2{g: q}).Equal(&pointG2{g: expected}), "scalar %s", k)
+	}
+}
+
+func BenchmarkG2Mul(b *testing.B) {
+	suite := NewSuite()
+	k := suite.G2().Scalar().Pick(random.New())
+	p := suite.G2().Point().Pick(random.New())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Mul(k, p)
+	}
+}
+
 func TestGT(t *testing.T) {
 	suite := NewSuite()
 	k := suite.GT().Scalar().Pick(random.New())
@@ -191,6 +308,37 @@ func TestGT(t *testing.T) {
 	require.Equal(t, ma, mb)
 }
 
+func TestGTExp(t *testing.T) {
+	suite := NewSuite()
+	a := suite.GT().Point().Pick(random.New()).(*pointGT).g
+
+	sq := (&gfP12{}).Square(a)
+	require.Equal(t, sq.String(), (&gfP12{}).CyclotomicSquare(a).String())
+
+	powers := []*big.Int{
+		big.NewInt(0), big.NewInt(1), big.NewInt(2), big.NewInt(15), big.NewInt(16),
+		new(big.Int).Sub(Order, big.NewInt(1)), Order, u, p,
+	}
+	for i := 0; i < 8; i++ {
+		powers = append(powers, &suite.GT().Scalar().Pick(random.New()).(*mod.Int).V)
+	}
+	for _, k := range powers {
+		expected := (&gfP12{}).Exp(a, k)
+		require.Equal(t, expected.String(), (&gfP12{}).ExpGT(a, k).String(), "power %s", k)
+		require.Equal(t, expected.String(), (&gfP12{}).CyclotomicExp(a, k).String(), "power %s", k)
+	}
+}
+
+func BenchmarkGTMul(b *testing.B) {
+	suite := NewSuite()
+	k := suite.GT().Scalar().Pick(random.New())
+	p := suite.GT().Point().Pick(random.New())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Mul(k, p)
+	}
+}
+
 func TestGTMarshal(t *testing.T) {
 	suite := NewSuite()
 	k := suite.GT().Scalar().Pick(random.New())
@@ -205,6 +353,49 @@ func TestGTMarshal(t *testing.T) {
 	require.Equal(t, ma, mb)
 }
 
+func TestGTUnmarshalMembership(t *testing.T) {
+	suite := NewSuite()
+	for _, s := range []*Suite{suite, NewSuite(Compressed())} {
+		// Unfinalized Miller loop outputs are not in GT
+		m := s.GT().Point().(*pointGT).Miller(suite.G1().Point().Base(), suite.G2().Point().Base())
+		buf, err := m.MarshalBinary()
+		require.NoError(t, err)
+		require.Error(t, s.GT().Point().UnmarshalBinary(buf))
+
+		require.Error(t, s.GT().Point().UnmarshalBinary(make([]byte, 12*32)))
+
+		// Nor are they after the easy part of the final exponentiation, which
+		// takes them to the cyclotomic subgroup
+		g := m.(*pointGT).g
+		c := (&gfP12{}).Invert(g)
+		c.Mul(c, (&gfP12{}).Conjugate(g))
+		c.Mul(c, (&gfP12{}).FrobeniusP2(c))
+		d := (&gfP12{}).FrobeniusP4(c)
+		require.Equal(t, d.Mul(d, c).String(), (&gfP12{}).FrobeniusP2(c).String())
+		require.False(t, c.IsInGT())
+		require.True(t, m.(*pointGT).Finalize().(*pointGT).g.IsInGT())
+	}
+
+	// Mul agrees with the generic exponentiation on decoded elements
+	k := suite.GT().Scalar().Pick(random.New())
+	pa := suite.GT().Point().Pick(random.New())
+	buf, err := pa.MarshalBinary()
+	require.NoError(t, err)
+	pb := suite.GT().Point()
+	require.NoError(t, pb.UnmarshalBinary(buf))
+	exp := (&gfP12{}).Exp(pa.(*pointGT).g, &k.(*mod.Int).V)
+	require.Equal(t, exp.String(), pb.Mul(k, pb).(*pointGT).g.String())
+
+	// and falls back to it on elements outside GT, such as Miller outputs and
+	// what they are combined with
+	m := suite.GT().Point().(*pointGT).Miller(suite.G1().Point().Base(), suite.G2().Point().Base())
+	exp.Exp(m.(*pointGT).g, &k.(*mod.Int).V)
+	require.Equal(t, exp.String(), suite.GT().Point().Mul(k, m).(*pointGT).g.String())
+	m.Add(m, pa)
+	exp.Exp(m.(*pointGT).g, &k.(*mod.Int).V)
+	require.Equal(t, exp.String(), suite.GT().Point().Mul(k, m.Clone()).(*pointGT).g.String())
+}
+
 func TestGTOps(t *testing.T) {
 	suite := NewSuite()
 	a := suite.GT().Point().Pick(random.New())
@@ -377,3 +568,287 @@ func Test_g2_2add_oncurve_issue400(t *testing.T) {
 	err = p.UnmarshalBinary(ma)
 	require.NoError(t, err)
 }
+
+func TestCompressed(t *testing.T) {
+	suite := NewSuite(Compressed())
+	legacy := NewSuite()
+	groups := []struct {
+		g, legacy kyber.Group
+		size      int
+	}{
+		{suite.G1(), legacy.G1(), 33},
+		{suite.G2(), legacy.G2(), 65},
+		{suite.GT(), legacy.GT(), 192},
+	}
+	for _, g := range groups {
+		require.Equal(t, g.size, g.g.PointLen())
+		for i := 0; i < 10; i++ {
+			k := g.g.Scalar().Pick(random.New())
+			p := g.g.Point().Mul(k, nil)
+			if i == 0 {
+				p.Null()
+			}
+			buf, err := p.MarshalBinary()
+			require.NoError(t, err)
+			require.Len(t, buf, g.size)
+
+			q := g.g.Point()
+			require.NoError(t, q.UnmarshalBinary(buf))
+			require.True(t, p.Equal(q))
+			buf2, err := q.MarshalBinary()
+			require.NoError(t, err)
+			require.Equal(t, buf, buf2)
+
+			// Either kind of point reads both encodings
+			r := g.legacy.Point()
+			require.NoError(t, r.UnmarshalBinary(buf))
+			require.True(t, r.Equal(p))
+			require.True(t, p.Equal(r))
+			lbuf, err := r.MarshalBinary()
+			require.NoError(t, err)
+			require.Len(t, lbuf, g.legacy.PointLen())
+			require.NoError(t, q.UnmarshalBinary(lbuf))
+			require.True(t, q.Equal(p))
+		}
+		type marshalID interface{ MarshalID() [8]byte }
+		require.NotEqual(t, g.g.Point().(marshalID).MarshalID(), g.legacy.Point().(marshalID).MarshalID())
+	}
+
+	// The sign bit selects the root
+	p := suite.G1().Point().Pick(random.New())
+	buf, err := p.MarshalBinary()
+	require.NoError(t, err)
+	buf[0] ^= 1
+	q := suite.G1().Point()
+	require.NoError(t, q.UnmarshalBinary(buf))
+	require.True(t, q.Equal(p.Clone().Neg(p)))
+	buf[0] = 4
+	require.Error(t, q.UnmarshalBinary(buf))
+
+	p = suite.G2().Point().Pick(random.New())
+	buf, err = p.MarshalBinary()
+	require.NoError(t, err)
+	buf[0] ^= 1
+	q = suite.G2().Point()
+	require.NoError(t, q.UnmarshalBinary(buf))
+	require.True(t, q.Equal(p.Clone().Neg(p)))
+
+	// Coordinates that are not reduced modulo p are rejected, so that every
+	// point has a single encoding. The base point of G1 has x = 1.
+	buf, err = suite.G1().Point().Base().MarshalBinary()
+	require.NoError(t, err)
+	prime := make([]byte, 32)
+	(*gfP)(&p2).Marshal(prime)
+	require.False(t, isReduced(prime))
+	prime[31]--
+	require.True(t, isReduced(prime))
+	bad, ok := addP(buf, 1)
+	require.True(t, ok)
+	require.Error(t, suite.G1().Point().UnmarshalBinary(bad))
+	for i := 0; i < 2; i++ {
+		for ok = false; !ok; {
+			buf, err = suite.G2().Point().Pick(random.New()).MarshalBinary()
+			require.NoError(t, err)
+			bad, ok = addP(buf, 1+32*i)
+		}
+		require.NoError(t, suite.G2().Point().UnmarshalBinary(buf))
+		require.Error(t, suite.G2().Point().UnmarshalBinary(bad))
+	}
+	for i := 0; i < 6; i++ {
+		for ok = false; !ok; {
+			buf, err = suite.GT().Point().Pick(random.New()).MarshalBinary()
+			require.NoError(t, err)
+			bad, ok = addP(buf, 32*i)
+		}
+		require.NoError(t, suite.GT().Point().UnmarshalBinary(buf))
+		require.Error(t, suite.GT().Point().UnmarshalBinary(bad))
+	}
+}
+
+// addP returns a copy of buf with p added to the 32-byte big-endian integer
+// at offset, and whether the sum still fits in 32 bytes.
+func addP(buf []byte, offset int) ([]byte, bool) {
+	x := new(big.Int).SetBytes(buf[offset : offset+32])
+	x.Add(x, p)
+	if x.BitLen() > 256 {
+		return nil, false
+	}
+	r := append([]byte{}, buf...)
+	b := x.Bytes()
+	copy(r[offset:offset+32], make([]byte, 32))
+	copy(r[offset+32-len(b):offset+32], b)
+	return r, true
+}
+
+func TestSqrt(t *testing.T) {
+	for i := 0; i < 20; i++ {
+		a, b := randomGFp(), &gfP{}
+		sq := &gfP{}
+		gfpMul(sq, a, a)
+		require.True(t, b.Sqrt(sq))
+		gfpMul(b, b, b)
+		require.Equal(t, *sq, *b)
+
+		// -1 is not a square as p ≡ 3 mod 4
+		gfpNeg(sq, sq)
+		require.False(t, b.Sqrt(sq))
+
+		c := &gfP2{*randomGFp(), *a}
+		d := &gfP2{}
+		sq2 := (&gfP2{}).Square(c)
+		require.True(t, d.Sqrt(sq2))
+		require.Equal(t, sq2.String(), d.Square(d).String())
+
+		// ξ is not a square in GF(p²), since the twist is sextic
+		sq2.MulXi(sq2)
+		require.False(t, d.Sqrt(sq2))
+	}
+}
+
+func randomGFp() *gfP {
+	k := random.Int(p, random.New())
+	buf := make([]byte, 32)
+	kb := k.Bytes()
+	copy(buf[32-len(kb):], kb)
+	e := &gfP{}
+	e.Unmarshal(buf)
+	montEncode(e, e)
+	return e
+}
+
+func TestMultiScalarMul(t *testing.T) {
+	suite := NewSuite()
+	for _, g := range []kyber.Group{suite.G1(), suite.G2(), suite.GT()} {
+		for _, n := range []int{0, 1, 5} {
+			scalars := make([]kyber.Scalar, n)
+			points := make([]kyber.Point, n)
+			expected := g.Point().Null()
+			for i := range scalars {
+				scalars[i] = g.Scalar().Pick(random.New())
+				if i != 2 {
+					points[i] = g.Point().Pick(random.New())
+				}
+				expected.Add(expected, g.Point().Mul(scalars[i], points[i]))
+			}
+			res := kyber.LinearCombination(g, scalars, points)
+			require.True(t, res.Equal(expected), "%s: %d terms", g, n)
+		}
+	}
+}
+
+func BenchmarkMultiScalarMulG1(b *testing.B) {
+	benchmarkMultiScalarMul(b, NewSuite().G1())
+}
+
+func BenchmarkMultiScalarMulG2(b *testing.B) {
+	benchmarkMultiScalarMul(b, NewSuite().G2())
+}
+
+func benchmarkMultiScalarMul(b *testing.B, g kyber.Group) {
+	const n = 16
+	scalars := make([]kyber.Scalar, n)
+	points := make([]kyber.Point, n)
+	for i := range scalars {
+		scalars[i] = g.Scalar().Pick(random.New())
+		points[i] = g.Point().Pick(random.New())
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		kyber.LinearCombination(g, scalars, points)
+	}
+}
+
+func TestMultiPair(t *testing.T) {
+	suite := NewSuite()
+	for _, n := range []int{0, 1, 2, 5} {
+		p1 := make([]kyber.Point, n)
+		p2 := make([]kyber.Point, n)
+		expected := suite.GT().Point().Null()
+		for i := range p1 {
+			p1[i] = suite.G1().Point().Pick(random.New())
+			p2[i] = suite.G2().Point().Pick(random.New())
+			if i == 3 {
+				p1[i].Null()
+			} else if i == 4 {
+				p2[i].Null()
+			}
+			expected.Add(expected, suite.Pair(p1[i], p2[i]))
+		}
+		res := suite.MultiPair(p1, p2)
+		require.True(t, res.Equal(expected), "%d pairs", n)
+	}
+
+	// e(aP, Q) * e(-P, aQ) == 1
+	a := suite.G1().Scalar().Pick(random.New())
+	p := suite.G1().Point().Pick(random.New())
+	q := suite.G2().Point().Pick(random.New())
+	res := suite.MultiPair([]kyber.Point{suite.G1().Point().Mul(a, p), suite.G1().Point().Neg(p)},
+		[]kyber.Point{q, suite.G2().Point().Mul(a, q)})
+	require.True(t, res.Equal(suite.GT().Point().Null()))
+}
+
+func TestG2Precompute(t *testing.T) {
+	suite := NewSuite()
+	p := suite.G1().Point().Pick(random.New())
+	q := suite.G2().Point().Pick(random.New())
+	c := q.Clone()
+	expected := suite.Pair(p, q)
+
+	q.(kyber.Precomputable).Precompute()
+	require.NotNil(t, q.(*pointG2).preparedLines())
+	require.True(t, suite.Pair(p, q).Equal(expected))
+	require.True(t, suite.GT().Point().(*pointGT).Miller(p, q).Equal(
+		suite.GT().Point().(*pointGT).Miller(p, c)))
+
+	// The lines are shared by copies, and dropped when the value changes.
+	r := suite.G2().Point().Set(q)
+	require.NotNil(t, r.(*pointG2).preparedLines())
+	q.Add(q, q)
+	require.Nil(t, q.(*pointG2).preparedLines())
+	c.Add(c, c)
+	require.True(t, suite.Pair(p, q).Equal(suite.Pair(p, c)))
+
+	// The generator comes with its lines.
+	base := suite.G2().Point().Base()
+	require.NotNil(t, base.(*pointG2).preparedLines())
+	expected = suite.Pair(suite.G1().Point().Base(), base)
+	require.True(t, expected.Equal(suite.GT().Point().Base()))
+}
+
+func BenchmarkPairPrecomputed(b *testing.B) {
+	suite := NewSuite()
+	p := suite.G1().Point().Pick(random.New())
+	q := suite.G2().Point().Pick(random.New())
+	q.(kyber.Precomputable).Precompute()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		suite.Pair(p, q)
+	}
+}
+
+func BenchmarkPair(b *testing.B) {
+	suite := NewSuite()
+	p := suite.G1().Point().Pick(random.New())
+	q := suite.G2().Point().Pick(random.New())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		suite.Pair(p, q)
+	}
+}
+
+func BenchmarkMultiPair(b *testing.B) {
+	suite := NewSuite()
+	for _, n := range []int{2, 8} {
+		p1 := make([]kyber.Point, n)
+		p2 := make([]kyber.Point, n)
+		for i := range p1 {
+			p1[i] = suite.G1().Point().Pick(random.New())
+			p2[i] = suite.G2().Point().Pick(random.New())
+		}
+		b.Run(fmt.Sprint(n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				suite.MultiPair(p1, p2)
+			}
+		})
+	}
+}
@@ -58,6 +58,31 @@ func (c *twistPoint) IsOnCurve() bool {
 	return *y2 == *x3
 }
 
+// IsInG2 returns true iff c, a point on the curve, is in G₂, the subgroup of
+// order Order. On the twist of a BN curve, this holds exactly when ψ(c) =
+// [6u²]c, 6u² being p modulo Order, which takes a multiplication by a 128-bit
+// scalar instead of one by Order. It runs in variable time.
+func (c *twistPoint) IsInG2() bool {
+	if c.IsInfinity() {
+		return true
+	}
+
+	sum, t := &twistPoint{}, &twistPoint{}
+	for i := sixuSquared.BitLen(); i >= 0; i-- {
+		t.Double(sum)
+		if sixuSquared.Bit(i) != 0 {
+			sum.Add(t, c)
+		} else {
+			sum.Set(t)
+		}
+	}
+	t.frobenius(c)
+
+	sum.MakeAffine()
+	t.MakeAffine()
+	return sum.x == t.x && sum.y == t.y
+}
+
 func (c *twistPoint) SetInfinity() {
 	c.x.SetZero()
 	c.y.SetOne()
@@ -157,14 +182,201 @@ func (c *twistPoint) Double(a *twistPoint) {
 	c.y.Sub(t2, t)
 }
 
+// Mul sets c to scalar*a for a point a of G₂. The scalar is split into four
+// parts of at most 66 bits with the endomorphism ψ, which are multiplied
+// together with a fixed sequence of group operations and table lookups, as in
+// curvePoint.Mul. As there, the split runs on big.Int and is not constant
+// time.
 func (c *twistPoint) Mul(a *twistPoint, scalar *big.Int) {
-	sum, t := &twistPoint{}, &twistPoint{}
+	if a.IsInfinity() {
+		c.SetInfinity()
+		return
+	}
+	k := glsDecompose(scalar)
+	var negs [4]uint64
+	for i := range k {
+		negs[i] = uint64(k[i].Sign()>>1) & 1
+	}
+
+	// tables[i] holds ±b,±3b,...,±15b for b = ψⁱ(a), with the sign of k[i]
+	var tables [4][8]twistPoint
+	t := &twistPoint{}
+	tables[0][0].Set(a)
+	t.Neg(a)
+	tables[0][0].cmov(t, negs[0])
+	t.Double(&tables[0][0])
+	for j := 1; j < 8; j++ {
+		tables[0][j].Add(&tables[0][j-1], t)
+	}
+	for i := 1; i < len(tables); i++ {
+		for j := range tables[i] {
+			tables[i][j].frobenius(&tables[i-1][j])
+			t.Neg(&tables[i][j])
+			tables[i][j].cmov(t, negs[i-1]^negs[i])
+		}
+	}
+
+	var digits [4][glsDigits]int8
+	var even [4]uint64
+	for i := range k {
+		even[i] = recodeOdd(digits[i][:], k[i])
+	}
 
-	for i := scalar.BitLen(); i >= 0; i-- {
+	sum, q := &twistPoint{}, &twistPoint{}
+	sum.lookupOdd(&tables[0], digits[0][glsDigits-1])
+	for k := 1; k < len(tables); k++ {
+		q.lookupOdd(&tables[k], digits[k][glsDigits-1])
+		t.Add(sum, q)
+		sum.Set(t)
+	}
+	for i := glsDigits - 2; i >= 0; i-- {
+		for j := 0; j < 4; j++ {
+			t.Double(sum)
+			sum.Set(t)
+		}
+		for k := range tables {
+			q.lookupOdd(&tables[k], digits[k][i])
+			t.Add(sum, q)
+			sum.Set(t)
+		}
+	}
+	for i := range tables {
+		q.Neg(&tables[i][0])
+		t.Add(sum, q)
+		sum.cmov(t, even[i])
+	}
+
+	c.Set(sum)
+}
+
+// glsDigits is the number of signed 4-bit digits of the parts of a scalar.
+const glsDigits = 17
+
+// glsDecompose returns k[0],...,k[3] such that k ≡ k[0] + k[1]·p + k[2]·p² +
+// k[3]·p³ mod Order and |k[i]| < 2⁶⁶, by rounding k along glsBasis. It runs
+// in variable time.
+func glsDecompose(k *big.Int) (parts [4]*big.Int) {
+	k = new(big.Int).Mod(k, Order)
+	var c [4]*big.Int
+	for j := range c {
+		c[j] = new(big.Int).Mul(k, glsRound[j])
+		c[j].Rsh(c[j], 256)
+	}
+
+	t := new(big.Int)
+	for i := range parts {
+		parts[i] = new(big.Int)
+		if i == 0 {
+			parts[i].Set(k)
+		}
+		for j := range c {
+			parts[i].Sub(parts[i], t.Mul(c[j], glsBasis[j][i]))
+		}
+	}
+	return parts
+}
+
+// lookupOdd sets c to the multiple d·a of a in table, which holds a,3a,...,15a,
+// for an odd digit d. It reads every entry of the table.
+func (c *twistPoint) lookupOdd(table *[8]twistPoint, d int8) {
+	mask := d >> 7
+	abs := uint64((d ^ mask) - mask)
+	for j := range table {
+		diff := uint64(2*j+1) ^ abs
+		c.cmov(&table[j], (diff-1)>>63)
+	}
+	neg := &twistPoint{}
+	neg.Neg(c)
+	c.cmov(neg, uint64(mask)&1)
+}
+
+// cmov sets c to a if b is 1 and leaves it unchanged if b is 0, in constant
+// time.
+func (c *twistPoint) cmov(a *twistPoint, b uint64) {
+	mask := -b
+	for i := range c.x.x {
+		c.x.x[i] ^= (c.x.x[i] ^ a.x.x[i]) & mask
+		c.x.y[i] ^= (c.x.y[i] ^ a.x.y[i]) & mask
+		c.y.x[i] ^= (c.y.x[i] ^ a.y.x[i]) & mask
+		c.y.y[i] ^= (c.y.y[i] ^ a.y.y[i]) & mask
+		c.z.x[i] ^= (c.z.x[i] ^ a.z.x[i]) & mask
+		c.z.y[i] ^= (c.z.y[i] ^ a.z.y[i]) & mask
+		c.t.x[i] ^= (c.t.x[i] ^ a.t.x[i]) & mask
+		c.t.y[i] ^= (c.t.y[i] ^ a.t.y[i]) & mask
+	}
+}
+
+// frobenius sets c to ψ(a), the p-power Frobenius map carried over to the
+// twist, which acts as multiplication by p on G₂.
+func (c *twistPoint) frobenius(a *twistPoint) {
+	c.x.Conjugate(&a.x).Mul(&c.x, xiToPMinus1Over3)
+	c.y.Conjugate(&a.y).Mul(&c.y, xiToPMinus1Over2)
+	c.z.Conjugate(&a.z)
+	c.t.Conjugate(&a.t)
+}
+
+// MultiMul sets c to the sum of scalars[i]*a[i], sharing the doublings
+// between all terms as in curvePoint.MultiMul. With few terms, every scalar is
+// split into four parts with ψ first, so that the points a[i] must lie in G₂.
+// It runs in variable time.
+func (c *twistPoint) MultiMul(a []*twistPoint, scalars []*big.Int) {
+	// Splitting quarters the doublings but not the additions, and costs three
+	// more tables per term, so it stops paying off beyond a few terms
+	parts := 4
+	if len(a) > 4 {
+		parts = 1
+	}
+
+	nafs := make([][]int8, parts*len(a))
+	tables := make([][8]twistPoint, parts*len(a)) // b,3b,5b,...,15b
+	top := 0
+	two := &twistPoint{}
+	for i := range a {
+		k := [4]*big.Int{scalars[i]}
+		if parts > 1 {
+			k = glsDecompose(scalars[i])
+		}
+		for j := 0; j < parts; j++ {
+			nafs[parts*i+j] = wnaf(new(big.Int).Abs(k[j]), 5)
+			if len(nafs[parts*i+j]) > top {
+				top = len(nafs[parts*i+j])
+			}
+		}
+
+		table := &tables[parts*i]
+		table[0].Set(a[i])
+		if k[0].Sign() < 0 {
+			table[0].Neg(a[i])
+		}
+		two.Double(&table[0])
+		for j := 1; j < 8; j++ {
+			table[j].Add(&table[j-1], two)
+		}
+		for l := 1; l < parts; l++ {
+			for j := range table {
+				tables[parts*i+l][j].frobenius(&tables[parts*i+l-1][j])
+				if (k[l-1].Sign() < 0) != (k[l].Sign() < 0) {
+					tables[parts*i+l][j].Neg(&tables[parts*i+l][j])
+				}
+			}
+		}
+	}
+
+	sum, t, neg := &twistPoint{}, &twistPoint{}, &twistPoint{}
+	sum.SetInfinity()
+	for k := top - 1; k >= 0; k-- {
 		t.Double(sum)
-		if scalar.Bit(i) != 0 {
-			sum.Add(t, a)
-		} else {
+		sum.Set(t)
+		for i := range nafs {
+			if k >= len(nafs[i]) || nafs[i][k] == 0 {
+				continue
+			}
+			if d := nafs[i][k]; d > 0 {
+				t.Add(sum, &tables[i][d/2])
+			} else {
+				neg.Neg(&tables[i][-d/2])
+				t.Add(sum, neg)
+			}
 			sum.Set(t)
 		}
 	}
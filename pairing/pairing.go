@@ -15,3 +15,39 @@ type Suite interface {
 	kyber.XOFFactory
 	kyber.Random
 }
+
+// MultiPairing is an optional interface for Suites that can compute the
+// product of several pairings, e(p1[0], p2[0]) * ... * e(p1[n-1], p2[n-1]),
+// written as a sum in GT, faster than pairing each pair separately, e.g. by
+// sharing the final exponentiation. Generic code should call MultiPair or
+// PairingCheck, which fall back to Pair for other Suites.
+type MultiPairing interface {
+	// MultiPair returns the product of the pairings of p1[i] in G1 and
+	// p2[i] in G2. It panics if the two slices have different lengths.
+	MultiPair(p1, p2 []kyber.Point) kyber.Point
+}
+
+// MultiPair returns the product of the pairings of the points p1[i] in G1
+// and p2[i] in G2, using the MultiPairing implementation of suite if there
+// is one, and Pair otherwise.
+func MultiPair(suite Suite, p1, p2 []kyber.Point) kyber.Point {
+	if len(p1) != len(p2) {
+		panic("pairing: mismatched number of G1 and G2 points")
+	}
+	if mp, ok := suite.(MultiPairing); ok {
+		return mp.MultiPair(p1, p2)
+	}
+	sum := suite.GT().Point().Null()
+	for i := range p1 {
+		sum.Add(sum, suite.Pair(p1[i], p2[i]))
+	}
+	return sum
+}
+
+// PairingCheck returns whether the product of the pairings of the points
+// p1[i] in G1 and p2[i] in G2 is the identity of GT. An equality of
+// pairings e(a, b) == e(c, d) is checked as PairingCheck(suite, [a, -c],
+// [b, d]), which costs about half as much as computing both pairings.
+func PairingCheck(suite Suite, p1, p2 []kyber.Point) bool {
+	return MultiPair(suite, p1, p2).Equal(suite.GT().Point().Null())
+}
@@ -140,6 +140,11 @@ func (p *PriPoly) Equal(q *PriPoly) bool {
 // the standard base if b == nil.
 func (p *PriPoly) Commit(b kyber.Point) *PubPoly {
 	commits := make([]kyber.Point, p.Threshold())
+	// Precomputing multiples of b pays off for more than a few coefficients.
+	if _, ok := b.(kyber.Precomputable); ok && len(commits) > 3 {
+		b = b.Clone()
+		b.(kyber.Precomputable).Precompute()
+	}
 	for i := range commits {
 		commits[i] = p.g.Point().Mul(p.coeffs[i], b)
 	}
@@ -183,15 +188,13 @@ func RecoverSecret(g kyber.Group, shares []*PriShare, t, n int) (kyber.Scalar, e
 		return nil, errors.New("share: not enough shares to recover secret")
 	}
 
-	acc := g.Scalar().Zero()
-	num := g.Scalar()
-	den := g.Scalar()
 	tmp := g.Scalar()
+	nums := make([]kyber.Scalar, 0, len(x))
+	dens := make([]kyber.Scalar, 0, len(x))
 
 	for i, xi := range x {
-		yi := y[i]
-		num.Set(yi)
-		den.One()
+		num := g.Scalar().Set(y[i])
+		den := g.Scalar().One()
 		for j, xj := range x {
 			if i == j {
 				continue
@@ -199,7 +202,15 @@ func RecoverSecret(g kyber.Group, shares []*PriShare, t, n int) (kyber.Scalar, e
 			num.Mul(num, xj)
 			den.Mul(den, tmp.Sub(xj, xi))
 		}
-		acc.Add(acc, num.Div(num, den))
+		nums = append(nums, num)
+		dens = append(dens, den)
+	}
+
+	// Invert all the denominators at once
+	kyber.BatchInv(dens)
+	acc := g.Scalar().Zero()
+	for i := range nums {
+		acc.Add(acc, tmp.Mul(nums[i], dens[i]))
 	}
 
 	return acc, nil
@@ -338,11 +349,13 @@ func (p *PubPoly) Commit() kyber.Point {
 // Eval computes the public share v = p(i).
 func (p *PubPoly) Eval(i int) *PubShare {
 	xi := p.g.Scalar().SetInt64(1 + int64(i)) // x-coordinate of this share
-	v := p.g.Point().Null()
-	for j := p.Threshold() - 1; j >= 0; j-- {
-		v.Mul(xi, v)
-		v.Add(v, p.commits[j])
+	powers := make([]kyber.Scalar, p.Threshold())
+	x := p.g.Scalar().One()
+	for j := range powers {
+		powers[j] = x.Clone()
+		x.Mul(x, xi)
 	}
+	v := kyber.LinearCombination(p.g, powers, p.commits)
 	return &PubShare{i, v}
 }
 
@@ -446,15 +459,14 @@ func RecoverCommit(g kyber.Group, shares []*PubShare, t, n int) (kyber.Point, er
 		return nil, errors.New("share: not enough good public shares to reconstruct secret commitment")
 	}
 
-	num := g.Scalar()
-	den := g.Scalar()
 	tmp := g.Scalar()
-	Acc := g.Point().Null()
-	Tmp := g.Point()
+	coeffs := make([]kyber.Scalar, 0, len(x))
+	dens := make([]kyber.Scalar, 0, len(x))
+	points := make([]kyber.Point, 0, len(x))
 
 	for i, xi := range x {
-		num.One()
-		den.One()
+		num := g.Scalar().One()
+		den := g.Scalar().One()
 		for j, xj := range x {
 			if i == j {
 				continue
@@ -462,11 +474,18 @@ func RecoverCommit(g kyber.Group, shares []*PubShare, t, n int) (kyber.Point, er
 			num.Mul(num, xj)
 			den.Mul(den, tmp.Sub(xj, xi))
 		}
-		Tmp.Mul(num.Div(num, den), y[i])
-		Acc.Add(Acc, Tmp)
+		coeffs = append(coeffs, num)
+		dens = append(dens, den)
+		points = append(points, y[i])
 	}
 
-	return Acc, nil
+	// Invert all the denominators at once
+	kyber.BatchInv(dens)
+	for i := range coeffs {
+		coeffs[i].Mul(coeffs[i], dens[i])
+	}
+
+	return kyber.LinearCombination(g, coeffs, points), nil
 }
 
 // RecoverPubPoly reconstructs the full public polynomial from a set of public
@@ -511,16 +530,15 @@ func lagrangeBasis(g kyber.Group, i int, xs map[int]kyber.Scalar) *PriPoly {
 	}
 	// compute lagrange basis l_j
 	den := g.Scalar().One()
-	var acc = g.Scalar().One()
+	tmp := g.Scalar()
 	for m, xm := range xs {
 		if i == m {
 			continue
 		}
 		basis = basis.Mul(minusConst(g, xm))
-		den.Sub(xs[i], xm) // den = xi - xm
-		den.Inv(den)       // den = 1 / den
-		acc.Mul(acc, den)  // acc = acc * den
+		den.Mul(den, tmp.Sub(xs[i], xm)) // den = den * (xi - xm)
 	}
+	acc := den.Inv(den) // acc = 1 / den
 
 	// multiply all coefficients by the denominator
 	for i := range basis.coeffs {
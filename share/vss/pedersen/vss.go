@@ -202,9 +202,8 @@ func (d *Dealer) EncryptedDeal(i int) (*EncryptedDeal, error) {
 		return nil, err
 	}
 	encrypted := gcm.Seal(nil, nonce, dealBuff, d.hkdfContext)
-	dhBytes, _ := dhPublic.MarshalBinary()
 	return &EncryptedDeal{
-		DHKey:     dhBytes,
+		DHKey:     dhPublicBuff,
 		Signature: signature,
 		Nonce:     nonce,
 		Cipher:    encrypted,
@@ -727,11 +726,11 @@ func validT(t int, verifiers []kyber.Point) bool {
 }
 
 func deriveH(suite Suite, verifiers []kyber.Point) kyber.Point {
-	var b bytes.Buffer
+	b := make([]byte, 0, len(verifiers)*suite.PointLen())
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(&b)
+		b, _ = kyber.AppendBinary(b, v)
 	}
-	base := suite.Point().Pick(suite.XOF(b.Bytes()))
+	base := suite.Point().Pick(suite.XOF(b))
 	return base
 }
 
@@ -747,13 +746,15 @@ func sessionID(suite Suite, dealer kyber.Point, verifiers, commitments []kyber.P
 	h := suite.Hash()
 	_, _ = dealer.MarshalTo(h)
 
-	for _, v := range verifiers {
-		_, _ = v.MarshalTo(h)
+	buf := make([]byte, (len(verifiers)+len(commitments))*suite.PointLen())
+	split := len(verifiers) * suite.PointLen()
+	if err := kyber.MarshalPoints(suite, buf[:split], verifiers); err != nil {
+		return nil, err
 	}
-
-	for _, c := range commitments {
-		_, _ = c.MarshalTo(h)
+	if err := kyber.MarshalPoints(suite, buf[split:], commitments); err != nil {
+		return nil, err
 	}
+	_, _ = h.Write(buf)
 	_ = binary.Write(h, binary.LittleEndian, uint32(t))
 
 	return h.Sum(nil), nil
@@ -89,24 +89,22 @@ func BatchVerify(suite pairing.Suite, publics []kyber.Point, msgs [][]byte, sig
 		return err
 	}
 
-	var aggregatedLeft kyber.Point
+	// e(H(m_1), X_1) * ... * e(H(m_n), X_n) == e(S, B2) is checked as
+	// a single product of pairings with e(-S, B2)
+	p1 := make([]kyber.Point, 0, len(msgs)+1)
+	p2 := make([]kyber.Point, 0, len(msgs)+1)
 	for i := range msgs {
 		hashable, ok := suite.G1().Point().(hashablePoint)
 		if !ok {
 			return errors.New("bls: point needs to implement hashablePoint")
 		}
-		hm := hashable.Hash(msgs[i])
-		pair := suite.Pair(hm, publics[i])
-
-		if i == 0 {
-			aggregatedLeft = pair
-		} else {
-			aggregatedLeft.Add(aggregatedLeft, pair)
-		}
+		p1 = append(p1, hashable.Hash(msgs[i]))
+		p2 = append(p2, publics[i])
 	}
+	p1 = append(p1, s.Neg(s))
+	p2 = append(p2, suite.G2().Point().Base())
 
-	right := suite.Pair(s, suite.G2().Point().Base())
-	if !aggregatedLeft.Equal(right) {
+	if !pairing.PairingCheck(suite, p1, p2) {
 		return errors.New("bls: invalid signature")
 	}
 	return nil
@@ -122,13 +120,15 @@ func Verify(suite pairing.Suite, X kyber.Point, msg, sig []byte) error {
 		return errors.New("bls: point needs to implement hashablePoint")
 	}
 	HM := hashable.Hash(msg)
-	left := suite.Pair(HM, X)
 	s := suite.G1().Point()
 	if err := s.UnmarshalBinary(sig); err != nil {
 		return err
 	}
-	right := suite.Pair(s, suite.G2().Point().Base())
-	if !left.Equal(right) {
+	// e(H(m), X) == e(S, B2) is checked as e(H(m), X) * e(-S, B2) == 1,
+	// with a single final exponentiation
+	s.Neg(s)
+	if !pairing.PairingCheck(suite, []kyber.Point{HM, s},
+		[]kyber.Point{X, suite.G2().Point().Base()}) {
 		return errors.New("bls: invalid signature")
 	}
 	return nil
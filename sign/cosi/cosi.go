@@ -211,9 +211,8 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	// from s = k * a + r => s * B = k * a * B + r * B <=> s*B = k*A + r*B
 	// <=> s*B + k*-A = r*B
 	minusPublic := suite.Point().Neg(A)
-	kA := suite.Point().Mul(k, minusPublic)
-	sB := suite.Point().Mul(r, nil)
-	left := suite.Point().Add(kA, sB)
+	left := kyber.LinearCombination(suite, []kyber.Scalar{k, r},
+		[]kyber.Point{minusPublic, nil})
 
 	if !left.Equal(V) {
 		return errors.New("recreated response is different from signature")
@@ -3,6 +3,7 @@
 package eddsa
 
 import (
+	"bytes"
 	"crypto/cipher"
 	"crypto/sha512"
 	"errors"
@@ -10,6 +11,7 @@ import (
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
+	"go.dedis.ch/kyber/v3/util/random"
 )
 
 var group = new(edwards25519.Curve)
@@ -75,84 +77,304 @@ func (e *EdDSA) UnmarshalBinary(buff []byte) error {
 
 // Sign will return a EdDSA signature of the message msg using Ed25519.
 func (e *EdDSA) Sign(msg []byte) ([]byte, error) {
+	return e.sign(nil, msg, nil)
+}
+
+// sign signs msg with the encoding public of e.Public, which it computes
+// itself if public is nil. The domain separation prefix dom is hashed
+// before anything else, and is empty for Ed25519.
+func (e *EdDSA) sign(dom, msg, public []byte) ([]byte, error) {
+	// R || Public, and then the digests, share one buffer whose first
+	// half ends up holding the signature
+	buf := make([]byte, 0, 128)
+
 	hash := sha512.New()
+	_, _ = hash.Write(dom)
 	_, _ = hash.Write(e.prefix)
 	_, _ = hash.Write(msg)
 
 	// deterministic random secret and its commit
-	r := group.Scalar().SetBytes(hash.Sum(nil))
+	r := group.Scalar().SetBytes(hash.Sum(buf[64:64]))
 	R := group.Point().Mul(r, nil)
 
 	// challenge
 	// H( R || Public || Msg)
 	hash.Reset()
-	Rbuff, err := R.MarshalBinary()
+	_, _ = hash.Write(dom)
+	buf, err := kyber.AppendBinary(buf, R)
 	if err != nil {
 		return nil, err
 	}
-	Abuff, err := e.Public.MarshalBinary()
-	if err != nil {
+	if public != nil {
+		buf = append(buf, public...)
+	} else if buf, err = kyber.AppendBinary(buf, e.Public); err != nil {
 		return nil, err
 	}
 
-	_, _ = hash.Write(Rbuff)
-	_, _ = hash.Write(Abuff)
+	_, _ = hash.Write(buf)
 	_, _ = hash.Write(msg)
 
-	h := group.Scalar().SetBytes(hash.Sum(nil))
+	h := group.Scalar().SetBytes(hash.Sum(buf[64:64]))
 
 	// response
 	// s = r + h * s
 	s := group.Scalar().Mul(e.Secret, h)
 	s.Add(r, s)
 
-	sBuff, err := s.MarshalBinary()
-	if err != nil {
-		return nil, err
-	}
-
 	// return R || s
-	var sig [64]byte
-	copy(sig[:], Rbuff)
-	copy(sig[32:], sBuff)
-
-	return sig[:], nil
+	return kyber.AppendBinary(buf[:32], s)
 }
 
 // Verify uses a public key, a message and a signature. It will return nil if
 // sig is a valid signature for msg created by key public, or an error otherwise.
+//
+// Verify checks the cofactorless equation s*B == R + h*A, and so rejects
+// some signatures that VerifyCofactored and VerifyBatch accept.
 func Verify(public kyber.Point, msg, sig []byte) error {
+	return verify(nil, public, msg, sig)
+}
+
+// verify checks sig against msg and public, with the domain separation
+// prefix dom.
+func verify(dom []byte, public kyber.Point, msg, sig []byte) error {
+	Pbuff, err := public.MarshalBinary()
+	if err != nil {
+		return err
+	}
+	R, s, h, err := decodeSignature(dom, Pbuff, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// reconstruct R == s*B - h*A, which holds iff S == k*A + R
+	h.Neg(h)
+	sBhA := kyber.LinearCombination(group, []kyber.Scalar{s, h},
+		[]kyber.Point{nil, public})
+
+	if !sBhA.Equal(R) {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// VerifyBatch verifies that every sigs[i] is a valid signature of msgs[i]
+// under publics[i]. It returns nil if all of them are valid, and otherwise
+// an error naming the first invalid signature.
+//
+// The signatures are checked together, by testing a random linear
+// combination of the cofactored verification equations 8*s_i*B ==
+// 8*R_i + 8*h_i*A_i with a single multi-scalar multiplication. The
+// coefficients are fresh random 128-bit scalars. This costs a fraction of
+// n calls to Verify. When the batch fails, each signature is checked on
+// its own, with the same equation, to find the culprit.
+//
+// VerifyBatch accepts exactly the signatures that VerifyCofactored accepts,
+// whatever the size of the batch, including one. Unlike Verify, these
+// include signatures whose R or public key have a small order component
+// that the cofactor cancels out.
+func VerifyBatch(publics []kyber.Point, msgs, sigs [][]byte) error {
+	n := len(sigs)
+	if len(publics) != n || len(msgs) != n {
+		return errors.New("mismatched number of public keys, messages and signatures")
+	}
+	if n == 1 {
+		return VerifyCofactored(publics[0], msgs[0], sigs[0])
+	}
+
+	// scalars[0]*B + sum scalars[1+i]*R_i + scalars[1+n+i]*A_i, where
+	// scalars[0] = -sum z_i*s_i, scalars[1+i] = z_i, scalars[1+n+i] = z_i*h_i
+	scalars := make([]kyber.Scalar, 1+2*n)
+	points := make([]kyber.Point, 1+2*n)
+	scalars[0] = group.Scalar().Zero()
+	rand := random.New()
+	var zBuf [16]byte
+	for i := range sigs {
+		Pbuff, err := publics[i].MarshalBinary()
+		if err != nil {
+			return err
+		}
+		R, s, h, err := decodeSignature(nil, Pbuff, msgs[i], sigs[i])
+		if err != nil {
+			return fmt.Errorf("signature %d: %s", i, err)
+		}
+
+		random.Bytes(zBuf[:], rand)
+		z := group.Scalar().SetBytes(zBuf[:])
+		scalars[0].Add(scalars[0], s.Mul(s, z))
+		scalars[1+i] = z
+		points[1+i] = R
+		scalars[1+n+i] = h.Mul(h, z)
+		points[1+n+i] = publics[i]
+	}
+	scalars[0].Neg(scalars[0])
+
+	sum := kyber.LinearCombination(group, scalars, points)
+	for i := 0; i < 3; i++ {
+		sum.Add(sum, sum)
+	}
+	if sum.Equal(group.Point().Null()) {
+		return nil
+	}
+
+	for i := range sigs {
+		if err := VerifyCofactored(publics[i], msgs[i], sigs[i]); err != nil {
+			return fmt.Errorf("signature %d: %s", i, err)
+		}
+	}
+	// Not reached: if every signature passes on its own, 8 times each term
+	// of the combination is the identity, and so is 8 times their sum
+	return errors.New("batch verification failed")
+}
+
+// VerifyCofactored returns nil if sig is a valid signature for msg created by
+// key public, or an error otherwise, like Verify. It checks the cofactored
+// equation 8*s*B == 8*R + 8*h*A that RFC8032 allows instead, the one that
+// VerifyBatch uses. Applications that must agree on which signatures are
+// valid, whether they check them one by one or in batches, should use
+// VerifyCofactored and VerifyBatch together.
+func VerifyCofactored(public kyber.Point, msg, sig []byte) error {
+	Pbuff, err := public.MarshalBinary()
+	if err != nil {
+		return err
+	}
+	R, s, h, err := decodeSignature(nil, Pbuff, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	h.Neg(h)
+	sum := kyber.LinearCombination(group, []kyber.Scalar{s, h},
+		[]kyber.Point{nil, public})
+	sum.Sub(sum, R)
+	for i := 0; i < 3; i++ {
+		sum.Add(sum, sum)
+	}
+	if !sum.Equal(group.Point().Null()) {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// decodeSignature splits sig into R and s, and computes the challenge
+// h = H(dom || R || Pbuff || msg), where Pbuff is the encoded public key.
+func decodeSignature(dom, Pbuff, msg, sig []byte) (kyber.Point, kyber.Scalar, kyber.Scalar, error) {
 	if len(sig) != 64 {
-		return fmt.Errorf("signature length invalid, expect 64 but got %v", len(sig))
+		return nil, nil, nil, fmt.Errorf("signature length invalid, expect 64 but got %v", len(sig))
 	}
 
 	R := group.Point()
 	if err := R.UnmarshalBinary(sig[:32]); err != nil {
-		return fmt.Errorf("got R invalid point: %s", err)
+		return nil, nil, nil, fmt.Errorf("got R invalid point: %s", err)
 	}
 
 	s := group.Scalar()
 	if err := s.UnmarshalBinary(sig[32:]); err != nil {
-		return fmt.Errorf("schnorr: s invalid scalar %s", err)
+		return nil, nil, nil, fmt.Errorf("schnorr: s invalid scalar %s", err)
 	}
 
-	// reconstruct h = H(R || Public || Msg)
-	Pbuff, err := public.MarshalBinary()
-	if err != nil {
-		return err
+	// Reject s >= l, as RFC8032 section 5.1.7 requires, so that signatures
+	// cannot be altered by adding multiples of l to s. MarshalBinary
+	// reduces s.
+	if sBuf, _ := s.MarshalBinary(); !bytes.Equal(sBuf, sig[32:]) {
+		return nil, nil, nil, errors.New("signature is not canonical: s is not reduced")
 	}
+
+	// reconstruct h = H(R || Public || Msg)
 	hash := sha512.New()
+	_, _ = hash.Write(dom)
 	_, _ = hash.Write(sig[:32])
 	_, _ = hash.Write(Pbuff)
 	_, _ = hash.Write(msg)
 
 	h := group.Scalar().SetBytes(hash.Sum(nil))
-	// reconstruct S == k*A + R
-	S := group.Point().Mul(s, nil)
-	hA := group.Point().Mul(h, public)
-	RhA := group.Point().Add(R, hA)
+	return R, s, h, nil
+}
+
+// Signer signs messages with an EdDSA key pair, like EdDSA.Sign, but keeps
+// the encoding of the public key rather than computing it for every
+// signature. It is meant for long-lived keys that sign many messages.
+type Signer struct {
+	e      *EdDSA
+	public []byte
+}
+
+// NewSigner returns a Signer for the key pair e, which must not be modified
+// while the Signer is in use.
+func NewSigner(e *EdDSA) (*Signer, error) {
+	public, err := e.Public.MarshalBinary()
+	if err != nil {
+		return nil, err
+	}
+	return &Signer{e: e, public: public}, nil
+}
+
+// Public returns the public key of the Signer.
+func (s *Signer) Public() kyber.Point {
+	return s.e.Public
+}
+
+// Sign will return a EdDSA signature of the message msg using Ed25519.
+func (s *Signer) Sign(msg []byte) ([]byte, error) {
+	return s.e.sign(nil, msg, s.public)
+}
 
-	if !RhA.Equal(S) {
+// Verifier verifies signatures made by a single public key, like Verify, but
+// keeps the encoding of the key and a table of its multiples, which makes
+// every verification cheaper. It is meant for long-lived keys, such as
+// those of the validators of a chain, that sign many messages. The table
+// takes 30 KB of memory.
+type Verifier struct {
+	public  kyber.Point
+	encoded []byte
+}
+
+// NewVerifier returns a Verifier for signatures made by public.
+func NewVerifier(public kyber.Point) (*Verifier, error) {
+	Pbuff, err := public.MarshalBinary()
+	if err != nil {
+		return nil, err
+	}
+	v := &Verifier{public: public.Clone(), encoded: Pbuff}
+	if p, ok := v.public.(kyber.Precomputable); ok {
+		p.Precompute()
+	}
+	return v, nil
+}
+
+// Verify returns nil if sig is a valid signature for msg created by the
+// public key of v, or an error otherwise. It accepts the same signatures as
+// Verify: in particular, decodeSignature rejects any s that is not reduced
+// modulo l, which the fixed-base multiplication below requires.
+func (v *Verifier) Verify(msg, sig []byte) error {
+	R, s, h, err := decodeSignature(nil, v.encoded, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// reconstruct R == s*B - h*A, which holds iff S == k*A + R
+	sB := group.Point().Mul(s, nil)
+	hA := group.Point().Mul(h, v.public)
+	if !sB.Sub(sB, hA).Equal(R) {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// VerifyCofactored is like Verify, but accepts the same signatures as the
+// function VerifyCofactored.
+func (v *Verifier) VerifyCofactored(msg, sig []byte) error {
+	R, s, h, err := decodeSignature(nil, v.encoded, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	sum := group.Point().Mul(s, nil)
+	hA := group.Point().Mul(h, v.public)
+	sum.Sub(sum, hA).Sub(sum, R)
+	for i := 0; i < 3; i++ {
+		sum.Add(sum, sum)
+	}
+	if !sum.Equal(group.Point().Null()) {
 		return errors.New("reconstructed S is not equal to signature")
 	}
 	return nil
@@ -5,12 +5,16 @@ import (
 	"bytes"
 	"compress/gzip"
 	"crypto/cipher"
+	"crypto/sha512"
 	"encoding/hex"
+	"fmt"
+	"math/big"
 	"math/rand"
 	"os"
 	"strings"
 	"testing"
 
+	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
 
 	"github.com/stretchr/testify/assert"
@@ -204,3 +208,267 @@ func TestGolden(t *testing.T) {
 		t.Fatalf("error reading test data: %s", err)
 	}
 }
+
+// Signatures whose s is not reduced modulo l must be rejected, as RFC8032
+// section 5.1.7 requires.
+func TestVerifyNonCanonical(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	ed := NewEdDSA(suite.RandomStream())
+	msg := []byte("non-canonical")
+	sig, err := ed.Sign(msg)
+	assert.NoError(t, err)
+	assert.NoError(t, Verify(ed.Public, msg, sig))
+	verifier, err := NewVerifier(ed.Public)
+	assert.NoError(t, err)
+	assert.NoError(t, verifier.Verify(msg, sig))
+
+	for _, k := range []int64{1, 8} {
+		bad := addOrder(sig, k)
+		assert.Error(t, Verify(ed.Public, msg, bad))
+		assert.Error(t, verifier.Verify(msg, bad))
+		assert.Error(t, VerifyCofactored(ed.Public, msg, bad))
+		assert.Error(t, verifier.VerifyCofactored(msg, bad))
+		assert.Error(t, VerifyBatch([]kyber.Point{ed.Public}, [][]byte{msg}, [][]byte{bad}))
+		assert.Error(t, VerifyBatch([]kyber.Point{ed.Public, ed.Public},
+			[][]byte{msg, msg}, [][]byte{sig, bad}))
+	}
+}
+
+// addOrder returns a copy of sig with k times l added to its s.
+func addOrder(sig []byte, k int64) []byte {
+	le := func(b []byte) []byte {
+		r := make([]byte, len(b))
+		for i := range b {
+			r[i] = b[len(b)-1-i]
+		}
+		return r
+	}
+	l, _ := new(big.Int).SetString("7237005577332262213973186563042994240857116359379907606001950938285454250989", 10)
+	s := new(big.Int).SetBytes(le(sig[32:]))
+	s.Add(s, l.Mul(l, big.NewInt(k)))
+	buf := make([]byte, 32)
+	b := s.Bytes()
+	copy(buf[32-len(b):], b)
+	return append(append([]byte{}, sig[:32]...), le(buf)...)
+}
+
+func TestVerifyBatch(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 16
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		ed := NewEdDSA(suite.RandomStream())
+		publics[i] = ed.Public
+		msgs[i] = []byte(fmt.Sprintf("batch message %d", i))
+		sig, err := ed.Sign(msgs[i])
+		assert.NoError(t, err)
+		sigs[i] = sig
+	}
+	assert.NoError(t, VerifyBatch(publics, msgs, sigs))
+	assert.NoError(t, VerifyBatch(publics[:1], msgs[:1], sigs[:1]))
+	assert.NoError(t, VerifyBatch(nil, nil, nil))
+	assert.Error(t, VerifyBatch(publics, msgs[1:], sigs))
+
+	// A bad signature is reported by its index
+	bad := append([]byte{}, sigs[5]...)
+	bad[40] ^= 1
+	sigs[5] = bad
+	err := VerifyBatch(publics, msgs, sigs)
+	assert.Error(t, err)
+	assert.True(t, strings.HasPrefix(err.Error(), "signature 5:"), err.Error())
+
+	// So is a signature swapped with another message's
+	sigs[5] = sigs[6]
+	err = VerifyBatch(publics, msgs, sigs)
+	assert.Error(t, err)
+	assert.True(t, strings.HasPrefix(err.Error(), "signature 5:"), err.Error())
+
+	sigs[5] = sigs[5][:63]
+	assert.Error(t, VerifyBatch(publics, msgs, sigs))
+
+	// A signature whose R has a small order component is rejected by
+	// Verify, but accepted by VerifyCofactored and by VerifyBatch, whatever
+	// the size of the batch
+	torsion := group.Point() // (0,-1), of order 2
+	torsionBuf, _ := hex.DecodeString("ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f")
+	assert.NoError(t, torsion.UnmarshalBinary(torsionBuf))
+	ed := NewEdDSA(suite.RandomStream())
+	msg := []byte("small order R")
+	r := group.Scalar().Pick(suite.RandomStream())
+	R := group.Point().Mul(r, nil)
+	R.Add(R, torsion)
+	Rbuf, _ := R.MarshalBinary()
+	Abuf, _ := ed.Public.MarshalBinary()
+	hash := sha512.New()
+	_, _ = hash.Write(Rbuf)
+	_, _ = hash.Write(Abuf)
+	_, _ = hash.Write(msg)
+	h := group.Scalar().SetBytes(hash.Sum(nil))
+	sig, err := kyber.AppendBinary(Rbuf, group.Scalar().Add(r, h.Mul(ed.Secret, h)))
+	assert.NoError(t, err)
+
+	assert.Error(t, Verify(ed.Public, msg, sig))
+	assert.NoError(t, VerifyCofactored(ed.Public, msg, sig))
+	verifier, err := NewVerifier(ed.Public)
+	assert.NoError(t, err)
+	assert.Error(t, verifier.Verify(msg, sig))
+	assert.NoError(t, verifier.VerifyCofactored(msg, sig))
+	assert.NoError(t, VerifyBatch([]kyber.Point{ed.Public}, [][]byte{msg}, [][]byte{sig}))
+	sigs[5] = sigs[6]
+	msgs[5] = msgs[6]
+	publics[5] = publics[6]
+	assert.NoError(t, VerifyBatch(append(publics, ed.Public), append(msgs, msg), append(sigs, sig)))
+}
+
+func TestSignerVerifier(t *testing.T) {
+	for _, vec := range EdDSATestVectors {
+		seed, err := hex.DecodeString(vec.private)
+		assert.Nil(t, err)
+		ed := NewEdDSA(ConstantStream(seed))
+		signer, err := NewSigner(ed)
+		assert.NoError(t, err)
+		verifier, err := NewVerifier(signer.Public())
+		assert.NoError(t, err)
+
+		msg, _ := hex.DecodeString(vec.message)
+		sig, err := signer.Sign(msg)
+		assert.NoError(t, err)
+		assert.Equal(t, vec.signature, hex.EncodeToString(sig))
+		assert.NoError(t, verifier.Verify(msg, sig))
+		assert.NoError(t, verifier.VerifyCofactored(msg, sig))
+		assert.NoError(t, VerifyCofactored(signer.Public(), msg, sig))
+
+		sig[0] ^= 1
+		assert.Error(t, verifier.Verify(msg, sig))
+		assert.Error(t, verifier.VerifyCofactored(msg, sig))
+		assert.Error(t, VerifyCofactored(signer.Public(), msg, sig))
+		sig[0] ^= 1
+		assert.Error(t, verifier.Verify(append(msg, 0), sig))
+		assert.Error(t, verifier.Verify(msg, sig[:63]))
+	}
+}
+
+// Test vector of Ed25519ph, taken from RFC8032 section 7.3
+func TestEdDSASignPh(t *testing.T) {
+	seed, _ := hex.DecodeString("833fe62409237b9d62ec77587520911e9a759cec1d19755b7da901b96dca3d42")
+	ed := NewEdDSA(ConstantStream(seed))
+	assert.Equal(t, "ec172b93ad5e563bf4932c70e1245034c35467ef2efd4d64ebf819683467e2bf", ed.Public.String())
+
+	msg := []byte("abc")
+	sig, err := ed.SignReader(bytes.NewReader(msg), nil)
+	assert.NoError(t, err)
+	assert.Equal(t, "98a70222f0b8121aa9d30f813d683f809e462b469c7ff87639499bb94e6dae4131f85042463c2a355a2003d062adf5aaa10b8c61e636062aaad11c2a26083406", hex.EncodeToString(sig))
+
+	digest := sha512.Sum512(msg)
+	assert.NoError(t, VerifyPh(ed.Public, digest[:], nil, sig))
+	assert.NoError(t, VerifyReader(ed.Public, bytes.NewReader(msg), nil, sig))
+	assert.Error(t, VerifyReader(ed.Public, bytes.NewReader([]byte("abd")), nil, sig))
+	assert.Error(t, VerifyPh(ed.Public, digest[:], []byte("ctx"), sig))
+	assert.Error(t, Verify(ed.Public, digest[:], sig))
+	assert.Error(t, VerifyPh(ed.Public, digest[:32], nil, sig))
+
+	// Contexts are bound to the signature
+	context := []byte("kyber")
+	sig, err = ed.SignPh(digest[:], context)
+	assert.NoError(t, err)
+	assert.NoError(t, VerifyPh(ed.Public, digest[:], context, sig))
+	assert.Error(t, VerifyPh(ed.Public, digest[:], nil, sig))
+	_, err = ed.SignPh(digest[:], make([]byte, 256))
+	assert.Error(t, err)
+}
+
+func BenchmarkVerify(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	ed := NewEdDSA(suite.RandomStream())
+	msg := []byte("Hello Verify")
+	sig, err := ed.Sign(msg)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if err := Verify(ed.Public, msg, sig); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkVerifier(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	ed := NewEdDSA(suite.RandomStream())
+	msg := []byte("Hello Verify")
+	sig, err := ed.Sign(msg)
+	if err != nil {
+		b.Fatal(err)
+	}
+	v, err := NewVerifier(ed.Public)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if err := v.Verify(msg, sig); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkSign(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	ed := NewEdDSA(suite.RandomStream())
+	msg := []byte("Hello Sign")
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := ed.Sign(msg); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkSigner(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	s, err := NewSigner(NewEdDSA(suite.RandomStream()))
+	if err != nil {
+		b.Fatal(err)
+	}
+	msg := []byte("Hello Sign")
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := s.Sign(msg); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkVerifyBatch(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	for _, n := range []int{16, 64, 256} {
+		publics := make([]kyber.Point, n)
+		msgs := make([][]byte, n)
+		sigs := make([][]byte, n)
+		for i := range sigs {
+			ed := NewEdDSA(suite.RandomStream())
+			publics[i] = ed.Public
+			msgs[i] = []byte("Hello Verify")
+			sig, err := ed.Sign(msgs[i])
+			if err != nil {
+				b.Fatal(err)
+			}
+			sigs[i] = sig
+		}
+
+		b.Run(fmt.Sprint(n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if err := VerifyBatch(publics, msgs, sigs); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
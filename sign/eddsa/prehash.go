@@ -0,0 +1,90 @@
+package eddsa
+
+import (
+	"crypto/sha512"
+	"errors"
+	"io"
+
+	"go.dedis.ch/kyber/v3"
+)
+
+// dom2 returns the domain separation prefix of Ed25519ph with the given
+// context, as defined in RFC8032 section 5.1.
+func dom2(context []byte) ([]byte, error) {
+	if len(context) > 255 {
+		return nil, errors.New("context longer than 255 bytes")
+	}
+	dom := make([]byte, 0, 34+len(context))
+	dom = append(dom, "SigEd25519 no Ed25519 collisions"...)
+	dom = append(dom, 1, byte(len(context)))
+	return append(dom, context...), nil
+}
+
+// checkDigest returns an error unless digest has the length of a SHA-512
+// digest.
+func checkDigest(digest []byte) error {
+	if len(digest) != sha512.Size {
+		return errors.New("prehashed message is not a SHA-512 digest")
+	}
+	return nil
+}
+
+// SignPh will return a Ed25519ph signature, as defined in RFC8032, of the
+// message whose SHA-512 digest is digest. The context, which may be empty,
+// must be at most 255 bytes long and is needed again to verify the
+// signature. Ed25519ph signatures are not Ed25519 signatures of digest.
+func (e *EdDSA) SignPh(digest, context []byte) ([]byte, error) {
+	if err := checkDigest(digest); err != nil {
+		return nil, err
+	}
+	dom, err := dom2(context)
+	if err != nil {
+		return nil, err
+	}
+	return e.sign(dom, digest, nil)
+}
+
+// SignReader will return a Ed25519ph signature of the message read from r
+// until EOF, with the given context. The message is read only once and is
+// never held in memory, which suits large messages.
+func (e *EdDSA) SignReader(r io.Reader, context []byte) ([]byte, error) {
+	digest, err := digestReader(r)
+	if err != nil {
+		return nil, err
+	}
+	return e.SignPh(digest, context)
+}
+
+// VerifyPh returns nil if sig is a valid Ed25519ph signature, created by key
+// public with the given context, of the message whose SHA-512 digest is
+// digest, or an error otherwise.
+func VerifyPh(public kyber.Point, digest, context, sig []byte) error {
+	if err := checkDigest(digest); err != nil {
+		return err
+	}
+	dom, err := dom2(context)
+	if err != nil {
+		return err
+	}
+	return verify(dom, public, digest, sig)
+}
+
+// VerifyReader returns nil if sig is a valid Ed25519ph signature, created by
+// key public with the given context, of the message read from r until EOF,
+// or an error otherwise.
+func VerifyReader(public kyber.Point, r io.Reader, context, sig []byte) error {
+	digest, err := digestReader(r)
+	if err != nil {
+		return err
+	}
+	return VerifyPh(public, digest, context, sig)
+}
+
+// digestReader returns the SHA-512 digest of everything read from r.
+func digestReader(r io.Reader) ([]byte, error) {
+	hash := sha512.New()
+	if _, err := io.Copy(hash, r); err != nil {
+		return nil, err
+	}
+	return hash.Sum(nil), nil
+}
@@ -47,14 +47,12 @@ func Sign(s Suite, private kyber.Scalar, msg []byte) ([]byte, error) {
 	S := g.Scalar().Add(k, xh)
 
 	// return R || s
-	var b bytes.Buffer
-	if _, err := R.MarshalTo(&b); err != nil {
-		return nil, err
-	}
-	if _, err := S.MarshalTo(&b); err != nil {
+	b := make([]byte, 0, R.MarshalSize()+S.MarshalSize())
+	b, err = kyber.AppendBinary(b, R)
+	if err != nil {
 		return nil, err
 	}
-	return b.Bytes(), nil
+	return kyber.AppendBinary(b, S)
 }
 
 // Verify verifies a given Schnorr signature. It returns nil iff the
@@ -74,19 +72,23 @@ func Verify(g kyber.Group, public kyber.Point, msg, sig []byte) error {
 	if err := s.UnmarshalBinary(sig[pointSize:]); err != nil {
 		return err
 	}
+	// reject encodings of s that are not reduced, which would otherwise give
+	// several valid signatures for one (R, s)
+	if sBuf, err := s.MarshalBinary(); err != nil || !bytes.Equal(sBuf, sig[pointSize:]) {
+		return errors.New("schnorr: signature is not canonical")
+	}
 	// recompute hash(public || R || msg)
 	h, err := hash(g, public, R, msg)
 	if err != nil {
 		return err
 	}
 
-	// compute S = g^s
-	S := g.Point().Mul(s, nil)
-	// compute RAh = R + A^h
-	Ah := g.Point().Mul(h, public)
-	RAs := g.Point().Add(R, Ah)
+	// compute g^s * A^-h, which equals R iff g^s == R + A^h
+	h.Neg(h)
+	S := kyber.LinearCombination(g, []kyber.Scalar{s, h},
+		[]kyber.Point{nil, public})
 
-	if !S.Equal(RAs) {
+	if !S.Equal(R) {
 		return errors.New("schnorr: invalid signature")
 	}
 
@@ -48,6 +48,20 @@ func TestSchnorrSignature(t *testing.T) {
 	// wrong public key
 	wrKp := key.NewKeyPair(suite)
 	assert.Error(t, Verify(suite, wrKp.Public, msg, s))
+
+	// response not reduced modulo the group order, which Verify would
+	// otherwise accept as the same response: add the order, as (order-1)+1,
+	// to the little-endian response
+	minusOne, err := suite.Scalar().SetInt64(-1).MarshalBinary()
+	assert.NoError(t, err)
+	unreduced := append([]byte{}, s...)
+	carry := 1
+	for i, b := range minusOne {
+		sum := int(unreduced[32+i]) + int(b) + carry
+		unreduced[32+i] = byte(sum)
+		carry = sum >> 8
+	}
+	assert.Error(t, Verify(suite, kp.Public, msg, unreduced))
 }
 
 func TestEdDSACompatibility(t *testing.T) {
@@ -132,6 +132,111 @@ func testScalarClone(t *testing.T, g kyber.Group, rand cipher.Stream) {
 	}
 }
 
+func testLinearCombination(t *testing.T, g kyber.Group, rand cipher.Stream) {
+	for _, n := range []int{0, 1, 2, 10} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		sum := g.Point().Null()
+		for i := range scalars {
+			scalars[i] = g.Scalar().Pick(rand)
+			if i%3 != 1 { // leave some nil to use the base point
+				points[i] = g.Point().Pick(rand)
+			}
+			sum.Add(sum, g.Point().Mul(scalars[i], points[i]))
+		}
+		lc := kyber.LinearCombination(g, scalars, points)
+		if !lc.Equal(sum) {
+			t.Errorf("Linear combination of %d terms doesn't work: %v != %v", n, lc, sum)
+		}
+	}
+}
+
+func testMarshalPoints(t *testing.T, g kyber.Group, rand cipher.Stream) {
+	pl := g.PointLen()
+	for _, n := range []int{0, 1, 10} {
+		points := make([]kyber.Point, n)
+		for i := range points {
+			points[i] = g.Point().Pick(rand)
+		}
+		if n > 0 {
+			points[n-1].Null()
+		}
+		buf := make([]byte, n*pl)
+		if err := kyber.MarshalPoints(g, buf, points); err != nil {
+			t.Fatalf("MarshalPoints of %d points: %v", n, err)
+		}
+		for i, p := range points {
+			b, _ := p.MarshalBinary()
+			if !bytes.Equal(b, buf[i*pl:(i+1)*pl]) {
+				t.Errorf("MarshalPoints encodes point %d of %d as %x, should be %x",
+					i, n, buf[i*pl:(i+1)*pl], b)
+			}
+		}
+	}
+	if kyber.MarshalPoints(g, make([]byte, pl+1), []kyber.Point{g.Point().Base()}) == nil {
+		t.Error("MarshalPoints accepts a wrong size buffer")
+	}
+}
+
+func testAppendBinary(t *testing.T, g kyber.Group, rand cipher.Stream) {
+	objs := []kyber.Marshaling{
+		g.Point().Pick(rand), g.Point().Null(), g.Point().Base(),
+		g.Scalar().Pick(rand), g.Scalar().Zero(), g.Scalar().One(),
+	}
+	for _, m := range objs {
+		exp, _ := m.MarshalBinary()
+
+		prefix := []byte("prefix")
+		buf := make([]byte, len(prefix), len(prefix)+m.MarshalSize())
+		copy(buf, prefix)
+		b, err := kyber.AppendBinary(buf, m)
+		if err != nil {
+			t.Fatalf("AppendBinary: %v", err)
+		}
+		if !bytes.Equal(b[:len(prefix)], prefix) || !bytes.Equal(b[len(prefix):], exp) {
+			t.Errorf("AppendBinary gives %x, should append %x", b, exp)
+		}
+		if &b[0] != &buf[0] {
+			t.Error("AppendBinary reallocates a large enough buffer")
+		}
+		if b, _ = kyber.AppendBinary(nil, m); !bytes.Equal(b, exp) {
+			t.Errorf("AppendBinary to nil gives %x, should be %x", b, exp)
+		}
+
+		into := make([]byte, m.MarshalSize()+1)
+		n, err := kyber.MarshalInto(into, m)
+		if err != nil || !bytes.Equal(into[:n], exp) {
+			t.Errorf("MarshalInto gives %x, %v, should be %x", into[:n], err, exp)
+		}
+		if _, err := kyber.MarshalInto(into[:m.MarshalSize()-1], m); err == nil {
+			t.Error("MarshalInto accepts a too small buffer")
+		}
+	}
+}
+
+func testBatchInv(t *testing.T, g kyber.Group, rand cipher.Stream) {
+	for _, n := range []int{0, 1, 2, 10} {
+		scalars := make([]kyber.Scalar, n)
+		orig := make([]kyber.Scalar, n)
+		one := g.Scalar().One()
+		for i := range scalars {
+			// Scalars modulo the full order of a curve need not
+			// be invertible
+			scalars[i] = g.Scalar().Pick(rand)
+			for !one.Equal(g.Scalar().Mul(scalars[i], g.Scalar().Inv(scalars[i]))) {
+				scalars[i].Pick(rand)
+			}
+			orig[i] = scalars[i].Clone()
+		}
+		kyber.BatchInv(scalars)
+		for i := range scalars {
+			if !scalars[i].Equal(g.Scalar().Inv(orig[i])) {
+				t.Errorf("BatchInv of %d scalars doesn't invert scalar %d", n, i)
+			}
+		}
+	}
+}
+
 // Apply a generic set of validation tests to a cryptographic Group,
 // using a given source of [pseudo-]randomness.
 //
@@ -360,6 +465,10 @@ func testGroup(t *testing.T, g kyber.Group, rand cipher.Stream) []kyber.Point {
 	testPointClone(t, g, rand)
 	testScalarSet(t, g, rand)
 	testScalarClone(t, g, rand)
+	testLinearCombination(t, g, rand)
+	testMarshalPoints(t, g, rand)
+	testAppendBinary(t, g, rand)
+	testBatchInv(t, g, rand)
 
 	return points
 }